@@ -0,0 +1,154 @@
+/**
+ * @file    : bench_algorithms.cpp
+ * @brief   : Benchmark of the parallel algorithms against the sequential and
+ * std::execution::par versions of the standard library
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_algorithms.exe [array_size]
+ * The std::execution::par rows need a parallel backend of the standard library
+ * (TBB for libstdc++), CMake defines MYLIBRARY_HAVE_STD_PAR if it was found.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <vector>
+#include <numeric>
+#include <algorithm>
+#include <string>
+
+#ifdef MYLIBRARY_HAVE_STD_PAR
+#include <execution>
+#endif
+
+#include "../include/ParallelAlgorithms.hpp"
+#include "../include/Timer.hpp"
+
+// number of measurements per configuration
+static const unsigned int repetitions = 5;
+
+/**
+ * @brief measure a kernel and print one row
+ */
+template <typename Kernel>
+void run(const std::string& algorithm, const char* version, std::size_t size, Kernel&& kernel)
+{
+    Timer timer;
+    double checksum = kernel();
+    for(unsigned int r = 0; r < repetitions; r++){
+        timer.start();
+        checksum += kernel();
+        timer.stop();
+    }
+    std::cout << std::setw(18) << algorithm << std::setw(10) << version << std::setw(12)
+              << std::fixed << std::setprecision(3) << timer.get_mean_in_ns() / 1e6
+              << std::setw(10) << timer.get_sd_in_ns() / 1e6
+              << std::setw(10) << std::setprecision(2) << timer.get_mean_in_ns() / size
+              << "   (" << std::setprecision(0) << checksum << ")\n";
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t size = 1 << 24;
+    if(argc > 1){
+        size = std::max(1, std::atoi(argv[1]));
+    }
+    ThreadPool& pool = ThreadPool::get_global();
+    std::vector<double> x(size);
+    std::vector<double> y(size);
+    std::vector<double> out(size);
+    std::iota(x.begin(), x.end(), 0.0);
+    std::fill(y.begin(), y.end(), 0.5);
+    auto is_selected = [](double value){ return (long(value) & 3) == 1; };
+
+    std::cout << "threads: " << pool.get_num_threads() << ", array size: " << size << "\n";
+    std::cout << std::setw(18) << "algorithm" << std::setw(10) << "version" << std::setw(12) << "mean [ms]"
+              << std::setw(10) << "sd [ms]" << std::setw(10) << "ns/elem" << "\n";
+
+    // fill
+    run("fill", "seq", size, [&](){ std::fill(out.begin(), out.end(), 1.0); return out[0]; });
+#ifdef MYLIBRARY_HAVE_STD_PAR
+    run("fill", "std::par", size, [&](){ std::fill(std::execution::par, out.begin(), out.end(), 1.0); return out[0]; });
+#endif
+    run("fill", "parallel", size, [&](){ parallel_fill(out.begin(), out.end(), 1.0, pool); return out[0]; });
+
+    // iota, the standard library has no parallel version
+    run("iota", "seq", size, [&](){ std::iota(out.begin(), out.end(), 0.0); return out[size - 1]; });
+    run("iota", "parallel", size, [&](){ parallel_iota(out.begin(), out.end(), 0.0, pool); return out[size - 1]; });
+
+    // dot product
+    run("transform_reduce", "seq", size, [&](){
+        return std::transform_reduce(x.begin(), x.end(), y.begin(), 0.0);
+    });
+#ifdef MYLIBRARY_HAVE_STD_PAR
+    run("transform_reduce", "std::par", size, [&](){
+        return std::transform_reduce(std::execution::par, x.begin(), x.end(), y.begin(), 0.0);
+    });
+#endif
+    run("transform_reduce", "parallel", size, [&](){
+        return parallel_transform_reduce(x.begin(), x.end(), y.begin(), 0.0, std::plus<>(), std::multiplies<>(), pool);
+    });
+
+    // scans
+    run("inclusive_scan", "seq", size, [&](){
+        std::inclusive_scan(y.begin(), y.end(), out.begin());
+        return out[size - 1];
+    });
+#ifdef MYLIBRARY_HAVE_STD_PAR
+    run("inclusive_scan", "std::par", size, [&](){
+        std::inclusive_scan(std::execution::par, y.begin(), y.end(), out.begin());
+        return out[size - 1];
+    });
+#endif
+    run("inclusive_scan", "parallel", size, [&](){
+        parallel_inclusive_scan(y.begin(), y.end(), out.begin(), std::plus<>(), pool);
+        return out[size - 1];
+    });
+    run("exclusive_scan", "seq", size, [&](){
+        std::exclusive_scan(y.begin(), y.end(), out.begin(), 0.0);
+        return out[size - 1];
+    });
+#ifdef MYLIBRARY_HAVE_STD_PAR
+    run("exclusive_scan", "std::par", size, [&](){
+        std::exclusive_scan(std::execution::par, y.begin(), y.end(), out.begin(), 0.0);
+        return out[size - 1];
+    });
+#endif
+    run("exclusive_scan", "parallel", size, [&](){
+        parallel_exclusive_scan(y.begin(), y.end(), out.begin(), 0.0, std::plus<>(), pool);
+        return out[size - 1];
+    });
+
+    // stream compaction
+    run("copy_if", "seq", size, [&](){
+        return double(std::copy_if(x.begin(), x.end(), out.begin(), is_selected) - out.begin());
+    });
+#ifdef MYLIBRARY_HAVE_STD_PAR
+    run("copy_if", "std::par", size, [&](){
+        return double(std::copy_if(std::execution::par, x.begin(), x.end(), out.begin(), is_selected) - out.begin());
+    });
+#endif
+    run("copy_if", "parallel", size, [&](){
+        return double(parallel_copy_if(x.begin(), x.end(), out.begin(), is_selected, pool) - out.begin());
+    });
+
+    // stable partition, every version includes the copy restoring the input
+    run("partition", "seq", size, [&](){
+        out = x;
+        return double(std::stable_partition(out.begin(), out.end(), is_selected) - out.begin());
+    });
+#ifdef MYLIBRARY_HAVE_STD_PAR
+    run("partition", "std::par", size, [&](){
+        out = x;
+        return double(std::stable_partition(std::execution::par, out.begin(), out.end(), is_selected) - out.begin());
+    });
+#endif
+    run("partition", "parallel", size, [&](){
+        out = x;
+        return double(parallel_partition(out.begin(), out.end(), is_selected, pool) - out.begin());
+    });
+    return 0;
+}
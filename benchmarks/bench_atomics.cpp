@@ -0,0 +1,228 @@
+/**
+ * @file    : bench_atomics.cpp
+ * @brief   : Benchmark of the atomic primitives for every memory order and of
+ * native against lock-based DWCAS
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_atomics.exe [max_threads]
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#include "../include/AtomicPrimitives.hpp"
+#include "../include/SpinLock.hpp"
+#include "../include/AtomicLock.hpp"
+#include "../include/Timer.hpp"
+
+// operations per thread and measurement
+static const unsigned int ops_per_thread = 1000000;
+// number of measurements per configuration
+static const unsigned int repetitions = 3;
+
+/**
+ * @brief return the name of a memory order
+ */
+constexpr const char* order_name(std::memory_order order)
+{
+    return order == std::memory_order_relaxed ? "relaxed" :
+           order == std::memory_order_acquire ? "acquire" :
+           order == std::memory_order_release ? "release" :
+           order == std::memory_order_acq_rel ? "acq_rel" : "seq_cst";
+}
+
+// the orders are template parameters, so the builtins see compile-time constants
+// like they do inside the locks
+template <std::memory_order Order>
+struct Load{
+    static const char* name() { return "load"; }
+    static void operation(unsigned long* word, unsigned long) { (void)atomic_load(word, Order); }
+};
+
+template <std::memory_order Order>
+struct Store{
+    static const char* name() { return "store"; }
+    static void operation(unsigned long* word, unsigned long i) { atomic_store(word, i, Order); }
+};
+
+template <std::memory_order Order>
+struct Exchange{
+    static const char* name() { return "exchange"; }
+    static void operation(unsigned long* word, unsigned long i) { (void)atomic_exchange(word, i, Order); }
+};
+
+template <std::memory_order Order>
+struct FetchAdd{
+    static const char* name() { return "fetch_add"; }
+    static void operation(unsigned long* word, unsigned long) { (void)atomic_fetch_add(word, 1ul, Order); }
+};
+
+template <std::memory_order Order>
+struct CasStrong{
+    static const char* name() { return "cas"; }
+    static void operation(unsigned long* word, unsigned long)
+    {
+        unsigned long expected = atomic_load(word, std::memory_order_relaxed);
+        while(!atomic_cas(word, expected, expected + 1, Order, std::memory_order_relaxed)){
+        }
+    }
+};
+
+template <std::memory_order Order>
+struct CasWeak{
+    static const char* name() { return "cas_weak"; }
+    static void operation(unsigned long* word, unsigned long)
+    {
+        unsigned long expected = atomic_load(word, std::memory_order_relaxed);
+        while(!atomic_cas_weak(word, expected, expected + 1, Order, std::memory_order_relaxed)){
+        }
+    }
+};
+
+template <std::memory_order Order>
+struct TestAndSet{
+    static const char* name() { return "tas"; }
+    static void operation(unsigned long* word, unsigned long)
+    {
+        bool* flag = reinterpret_cast<bool*>(word);
+        (void)atomic_tas(flag, Order);
+        atomic_clear(flag, std::memory_order_release);
+    }
+};
+
+/**
+ * @brief legacy full barrier CAS() of SpinLock.hpp
+ */
+struct LegacyCas{
+    static const char* name() { return "CAS() (__sync)"; }
+    static void operation(unsigned long* word, unsigned long)
+    {
+        unsigned long expected = *(volatile unsigned long*)word;
+        while(!CAS(word, expected, expected + 1)){
+            expected = *(volatile unsigned long*)word;
+        }
+    }
+};
+
+/**
+ * @brief legacy TAS() of AtomicLock.hpp, an acquire barrier
+ */
+struct LegacyTas{
+    static const char* name() { return "TAS() (__sync)"; }
+    static void operation(unsigned long* word, unsigned long)
+    {
+        bool* flag = reinterpret_cast<bool*>(word);
+        (void)TAS(flag);
+        __sync_lock_release(flag);
+    }
+};
+
+/**
+ * @brief measure the ns per operation on one shared word
+ */
+template <typename Operation>
+void run_word(const char* order, unsigned int num_threads)
+{
+    Timer timer;
+    for(unsigned int r = 0; r < repetitions; r++){
+        alignas(64) unsigned long word = 0;
+        std::vector<std::thread> threads;
+        timer.start();
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&](){
+                for(unsigned int i = 0; i < ops_per_thread; i++){
+                    Operation::operation(&word, i);
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        timer.stop();
+    }
+    std::cout << std::setw(16) << Operation::name() << std::setw(9) << order << std::setw(9) << num_threads
+              << std::setw(12) << std::fixed << std::setprecision(2)
+              << timer.get_mean_in_ns() / ops_per_thread << "\n";
+}
+
+/**
+ * @brief measure the ns per increment of both words with native or lock-based DWCAS
+ */
+template <bool Native>
+void run_dwcas(unsigned int num_threads)
+{
+    Timer timer;
+    for(unsigned int r = 0; r < repetitions; r++){
+        DoubleWord word = {0, 0};
+        std::vector<std::thread> threads;
+        timer.start();
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&](){
+                DoubleWord expected = {0, 0};
+                for(unsigned int i = 0; i < ops_per_thread; i++){
+                    if constexpr(Native){
+                        while(!dwcas(&word, expected, DoubleWord{expected.low + 1, expected.high + 1})){
+                        }
+                    }else{
+                        while(!dwcas_locked(&word, expected, DoubleWord{expected.low + 1, expected.high + 1})){
+                        }
+                    }
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        timer.stop();
+    }
+    std::cout << std::setw(16) << (Native ? "dwcas" : "dwcas_locked") << std::setw(9) << "seq_cst"
+              << std::setw(9) << num_threads << std::setw(12) << std::fixed << std::setprecision(2)
+              << timer.get_mean_in_ns() / ops_per_thread << "\n";
+}
+
+/**
+ * @brief run an operation for every memory order in the list
+ */
+template <template <std::memory_order> class Operation, std::memory_order... Orders>
+void run_orders(unsigned int num_threads)
+{
+    (run_word<Operation<Orders>>(order_name(Orders), num_threads), ...);
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int max_threads = std::max(1u, std::thread::hardware_concurrency());
+    if(argc > 1){
+        max_threads = std::max(1, std::atoi(argv[1]));
+    }
+    std::cout << "native DWCAS: " << (has_native_dwcas() ? "yes" : "no") << "\n";
+    std::cout << std::setw(16) << "operation" << std::setw(9) << "order" << std::setw(9) << "threads"
+              << std::setw(12) << "ns/op" << "\n";
+    for(unsigned int num_threads = 1; num_threads <= max_threads; num_threads *= 2){
+        using std::memory_order_relaxed, std::memory_order_acquire, std::memory_order_release,
+              std::memory_order_acq_rel, std::memory_order_seq_cst;
+        run_orders<Load, memory_order_relaxed, memory_order_acquire, memory_order_seq_cst>(num_threads);
+        run_orders<Store, memory_order_relaxed, memory_order_release, memory_order_seq_cst>(num_threads);
+        run_orders<Exchange, memory_order_relaxed, memory_order_acquire, memory_order_release,
+                   memory_order_acq_rel, memory_order_seq_cst>(num_threads);
+        run_orders<FetchAdd, memory_order_relaxed, memory_order_acquire, memory_order_release,
+                   memory_order_acq_rel, memory_order_seq_cst>(num_threads);
+        run_orders<CasStrong, memory_order_relaxed, memory_order_acquire, memory_order_release,
+                   memory_order_acq_rel, memory_order_seq_cst>(num_threads);
+        run_orders<CasWeak, memory_order_relaxed, memory_order_acquire, memory_order_release,
+                   memory_order_acq_rel, memory_order_seq_cst>(num_threads);
+        run_orders<TestAndSet, memory_order_acquire, memory_order_seq_cst>(num_threads);
+        run_word<LegacyCas>("full", num_threads);
+        run_word<LegacyTas>("acquire", num_threads);
+        run_dwcas<true>(num_threads);
+        run_dwcas<false>(num_threads);
+    }
+    return 0;
+}
@@ -0,0 +1,214 @@
+/**
+ * @file    : bench_barriers.cpp
+ * @brief   : Benchmark of the barrier latency of SenseBarrier, DisseminationBarrier,
+ * TournamentBarrier, std::barrier and the OpenMP barrier across thread counts
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_barriers.exe [--threads=1,2,4] [--episodes=20000] [--no-pin]
+ * The OpenMP rows are only measured if the benchmark is built with OpenMP, its
+ * threads are placed by OMP_PROC_BIND and OMP_PLACES instead of --no-pin.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <barrier>
+#include <algorithm>
+#include <pthread.h>
+#include <sched.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "../include/Barrier.hpp"
+#include "../include/Timer.hpp"
+
+// number of measurements per configuration
+static const unsigned int repetitions = 3;
+
+/**
+ * @brief benchmark configuration
+ */
+struct Config{
+    std::vector<unsigned int> threads;
+    unsigned int episodes = 20000;
+    bool pin = true;
+};
+
+/**
+ * @brief parse a comma separated list of unsigned integers
+ */
+std::vector<unsigned int> parse_list(const std::string& list)
+{
+    std::vector<unsigned int> values;
+    std::stringstream stream(list);
+    std::string value;
+    while(std::getline(stream, value, ',')){
+        values.push_back(std::stoul(value));
+    }
+    return values;
+}
+
+/**
+ * @brief return the CPUs the process may run on
+ */
+std::vector<unsigned int> get_allowed_cpus()
+{
+    std::vector<unsigned int> cpus;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if(sched_getaffinity(0, sizeof(set), &set) == 0){
+        for(unsigned int cpu = 0; cpu < CPU_SETSIZE; cpu++){
+            if(CPU_ISSET(cpu, &set)){
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    if(cpus.empty()){
+        cpus.push_back(0);
+    }
+    return cpus;
+}
+
+/**
+ * @brief pin the calling thread to one CPU
+ */
+void pin_to_cpu(unsigned int cpu)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+/**
+ * @brief std::barrier with the interface of the library barriers
+ */
+class StdBarrier{
+    std::barrier<> barrier_;
+public:
+    explicit StdBarrier(unsigned int num_threads) : barrier_(num_threads) {}
+    void arrive_and_wait(unsigned int) { barrier_.arrive_and_wait(); }
+};
+
+/**
+ * @brief print one row
+ */
+void print(const char* name, unsigned int num_threads, const Timer& timer, unsigned int episodes)
+{
+    std::cout << std::setw(22) << name << std::setw(9) << num_threads
+              << std::setw(14) << std::fixed << std::setprecision(1) << timer.get_mean_in_ns() / episodes
+              << std::setw(12) << timer.get_sd_in_ns() / episodes << "\n";
+}
+
+/**
+ * @brief measure the time per episode of a barrier, every thread only passes the barrier
+ */
+template <typename Barrier>
+void run(const char* name, unsigned int num_threads, const Config& config, const std::vector<unsigned int>& cpus)
+{
+    Timer timer;
+    for(unsigned int r = 0; r < repetitions; r++){
+        Barrier barrier(num_threads);
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&, t](){
+                if(config.pin){
+                    pin_to_cpu(cpus[t % cpus.size()]);
+                }
+                // the first episode keeps thread creation out of the measurement,
+                // thread 0 leaves the last episode only after all arrived
+                barrier.arrive_and_wait(t);
+                if(t == 0){
+                    timer.start();
+                }
+                for(unsigned int e = 0; e < config.episodes; e++){
+                    barrier.arrive_and_wait(t);
+                }
+                if(t == 0){
+                    timer.stop();
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+    }
+    print(name, num_threads, timer, config.episodes);
+}
+
+#ifdef _OPENMP
+/**
+ * @brief measure the time per episode of the OpenMP barrier
+ */
+void run_openmp(unsigned int num_threads, const Config& config)
+{
+    Timer timer;
+    for(unsigned int r = 0; r < repetitions; r++){
+        #pragma omp parallel num_threads(num_threads)
+        {
+            #pragma omp barrier
+            #pragma omp master
+            timer.start();
+            for(unsigned int e = 0; e < config.episodes; e++){
+                #pragma omp barrier
+            }
+            #pragma omp master
+            timer.stop();
+        }
+    }
+    print("omp barrier", num_threads, timer, config.episodes);
+}
+#endif
+
+int main(int argc, char* argv[])
+{
+    Config config;
+    for(int i = 1; i < argc; i++){
+        const std::string arg = argv[i];
+        const std::size_t equal = arg.find('=');
+        const std::string key = arg.substr(0, equal);
+        const std::string value = (equal == std::string::npos) ? "" : arg.substr(equal + 1);
+        if(key == "--threads"){
+            config.threads = parse_list(value);
+        }else if(key == "--episodes"){
+            config.episodes = std::max(1ul, std::stoul(value));
+        }else if(key == "--no-pin"){
+            config.pin = false;
+        }else{
+            std::cerr << "unknown argument " << arg << "\n";
+            return 1;
+        }
+    }
+
+    // default thread sweep: powers of two up to the number of allowed CPUs
+    const std::vector<unsigned int> cpus = get_allowed_cpus();
+    if(config.threads.empty()){
+        for(unsigned int n = 1; n < cpus.size(); n *= 2){
+            config.threads.push_back(n);
+        }
+        config.threads.push_back(cpus.size());
+    }
+
+    std::cout << "cpus: " << cpus.size() << ", episodes: " << config.episodes
+              << ", pinned: " << (config.pin ? "yes" : "no") << "\n";
+    std::cout << std::setw(22) << "barrier" << std::setw(9) << "threads"
+              << std::setw(14) << "ns/episode" << std::setw(12) << "sd" << "\n";
+    for(unsigned int num_threads : config.threads){
+        run<SenseBarrier>("SenseBarrier", num_threads, config, cpus);
+        run<DisseminationBarrier>("DisseminationBarrier", num_threads, config, cpus);
+        run<TournamentBarrier>("TournamentBarrier", num_threads, config, cpus);
+        run<StdBarrier>("std::barrier", num_threads, config, cpus);
+#ifdef _OPENMP
+        run_openmp(num_threads, config);
+#endif
+    }
+    return 0;
+}
@@ -0,0 +1,133 @@
+/**
+ * @file    : bench_counter.cpp
+ * @brief   : Benchmark of ShardedCounter against a shared counter updated by
+ * fetch_add, a CAS loop, AtomicLock and SpinLock
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_counter.exe [max_threads]
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#include "../include/ShardedCounter.hpp"
+#include "../include/SpinLock.hpp"
+#include "../include/AtomicLock.hpp"
+#include "../include/Timer.hpp"
+
+// increments per thread and measurement
+static const unsigned int increments_per_thread = 1000000;
+// number of measurements per configuration
+static const unsigned int repetitions = 3;
+
+/**
+ * @brief one shared std::atomic<long> incremented by fetch_add
+ */
+class FetchAddCounter{
+    alignas(CACHE_LINE_SIZE) std::atomic<long> value_{0};
+public:
+    static const char* name() { return "fetch_add"; }
+    void increment() { value_.fetch_add(1, std::memory_order_relaxed); }
+    long get() const { return value_.load(); }
+};
+
+/**
+ * @brief one shared std::atomic<long> incremented by a CAS loop
+ */
+class CasCounter{
+    alignas(CACHE_LINE_SIZE) std::atomic<long> value_{0};
+public:
+    static const char* name() { return "CAS loop"; }
+    void increment()
+    {
+        long expected = value_.load(std::memory_order_relaxed);
+        while(!value_.compare_exchange_weak(expected, expected + 1, std::memory_order_relaxed)){
+        }
+    }
+    long get() const { return value_.load(); }
+};
+
+/**
+ * @brief critical_section-style counter, a long under a lock
+ */
+template <typename Lock>
+class LockedCounter{
+    Lock lock_;
+    long value_ = 0;
+public:
+    static const char* name();
+    void increment()
+    {
+        lock_.acquire();
+        value_++;
+        lock_.release();
+    }
+    long get() const { return value_; }
+};
+template <> const char* LockedCounter<AtomicLock>::name() { return "AtomicLock"; }
+template <> const char* LockedCounter<SpinLock>::name() { return "SpinLock"; }
+
+/**
+ * @brief ShardedCounter with the name used in the table
+ */
+class NamedShardedCounter : public ShardedCounter<long>{
+public:
+    static const char* name() { return "ShardedCounter"; }
+};
+
+/**
+ * @brief measure the ns per increment while all threads increment one counter
+ */
+template <typename Counter>
+void run(unsigned int num_threads)
+{
+    Timer timer;
+    for(unsigned int r = 0; r < repetitions; r++){
+        Counter counter;
+        std::vector<std::thread> threads;
+        timer.start();
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&](){
+                for(unsigned int i = 0; i < increments_per_thread; i++){
+                    counter.increment();
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        timer.stop();
+        if(counter.get() != long(num_threads) * increments_per_thread){
+            std::cerr << Counter::name() << ": wrong count\n";
+        }
+    }
+    std::cout << std::setw(16) << Counter::name() << std::setw(9) << num_threads
+              << std::setw(12) << std::fixed << std::setprecision(2)
+              << timer.get_mean_in_ns() / increments_per_thread
+              << std::setw(10) << timer.get_sd_in_ns() / increments_per_thread << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int max_threads = std::max(1u, std::thread::hardware_concurrency());
+    if(argc > 1){
+        max_threads = std::max(1, std::atoi(argv[1]));
+    }
+    std::cout << std::setw(16) << "counter" << std::setw(9) << "threads"
+              << std::setw(12) << "ns/inc" << std::setw(10) << "sd" << "\n";
+    for(unsigned int num_threads = 1; num_threads <= max_threads; num_threads *= 2){
+        run<NamedShardedCounter>(num_threads);
+        run<FetchAddCounter>(num_threads);
+        run<CasCounter>(num_threads);
+        run<LockedCounter<AtomicLock>>(num_threads);
+        run<LockedCounter<SpinLock>>(num_threads);
+    }
+    return 0;
+}
@@ -0,0 +1,119 @@
+/**
+ * @file    : bench_delegation.cpp
+ * @brief   : Benchmark of DelegationLock against SpinLock and AtomicLock for
+ * critical sections touching a growing amount of shared data
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_delegation.exe [max_threads]
+ * the DelegationLock runs one server thread in addition to the client threads
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+
+#include "../include/DelegationLock.hpp"
+#include "../include/SpinLock.hpp"
+#include "../include/AtomicLock.hpp"
+#include "../include/Timer.hpp"
+
+// critical sections per thread and measurement
+static const unsigned int ops_per_thread = 20000;
+// number of measurements per configuration
+static const unsigned int repetitions = 3;
+// words per cache line of the shared data
+static const unsigned int words_per_line = CACHE_LINE_SIZE / sizeof(unsigned long);
+
+/**
+ * @brief shared data, the critical section increments one word per cache line
+ */
+struct SharedData{
+    std::vector<unsigned long> words;
+    explicit SharedData(unsigned int num_lines) : words(std::size_t(num_lines) * words_per_line, 0) {}
+    void update(unsigned int i)
+    {
+        for(std::size_t w = i % words_per_line; w < words.size(); w += words_per_line){
+            words[w]++;
+        }
+    }
+};
+
+/**
+ * @brief shared data protected by a lock, every thread moves the data to its core
+ */
+template <typename Lock>
+class Locked{
+    Lock lock_;
+    SharedData data_;
+public:
+    static const char* name();
+    explicit Locked(unsigned int num_lines) : data_(num_lines) {}
+    void operation(unsigned int i) { lock_.acquire(); data_.update(i); lock_.release(); }
+};
+template <> const char* Locked<SpinLock>::name() { return "SpinLock"; }
+template <> const char* Locked<AtomicLock>::name() { return "AtomicLock"; }
+
+/**
+ * @brief shared data protected by DelegationLock, the data stays at the server
+ */
+class Delegated{
+    DelegationLock<SharedData> lock_;
+public:
+    static const char* name() { return "DelegationLock"; }
+    explicit Delegated(unsigned int num_lines) : lock_(num_lines) {}
+    void operation(unsigned int i) { lock_.apply([i](SharedData& data){ data.update(i); }); }
+};
+
+/**
+ * @brief measure the throughput of critical sections for a number of threads
+ */
+template <typename Shared>
+void run(unsigned int num_threads, unsigned int num_lines)
+{
+    Timer timer;
+    for(unsigned int r = 0; r < repetitions; r++){
+        Shared shared(num_lines);
+        std::vector<std::thread> threads;
+        timer.start();
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&](){
+                for(unsigned int i = 0; i < ops_per_thread; i++){
+                    shared.operation(i);
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        timer.stop();
+    }
+    const std::size_t num_operations = std::size_t(num_threads) * ops_per_thread;
+    std::cout << std::setw(16) << Shared::name() << std::setw(9) << num_threads
+              << std::setw(10) << num_lines * CACHE_LINE_SIZE
+              << std::setw(14) << std::fixed << std::setprecision(3)
+              << timer.get_mean_in_MFlop_per_sec(num_operations)
+              << std::setw(12) << timer.get_sd_in_MFlop_per_sec(num_operations) << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int max_threads = std::max(1u, std::thread::hardware_concurrency());
+    if(argc > 1){
+        max_threads = std::max(1, std::atoi(argv[1]));
+    }
+    std::cout << std::setw(16) << "lock" << std::setw(9) << "threads" << std::setw(10) << "bytes"
+              << std::setw(14) << "Mops/s" << std::setw(12) << "sd" << "\n";
+    for(unsigned int num_lines : {1u, 16u, 256u}){
+        for(unsigned int num_threads = 1; num_threads <= max_threads; num_threads *= 2){
+            run<Locked<SpinLock>>(num_threads, num_lines);
+            run<Locked<AtomicLock>>(num_threads, num_lines);
+            run<Delegated>(num_threads, num_lines);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,188 @@
+/**
+ * @file    : bench_epoch.cpp
+ * @brief   : Benchmark of the read-side cost of EpochDomain guards against a
+ * reader-writer lock, alone and on a read-mostly map
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_epoch.exe [max_threads]
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+
+#include "../include/EpochDomain.hpp"
+#include "../include/SpinLock.hpp"
+#include "../include/Timer.hpp"
+
+// empty critical sections for the read-side cost
+static const unsigned int num_sections = 2000000;
+// operations per thread and measurement on the map
+static const unsigned int operations_per_thread = 200000;
+// one operation out of write_period is an update
+static const unsigned int write_period = 1000;
+// keys in the map
+static const int num_keys = 256;
+// number of measurements per configuration
+static const unsigned int repetitions = 3;
+
+/**
+ * @brief read-mostly map as used so far, readers share a std::shared_mutex
+ */
+class RwLockMap{
+    mutable std::shared_mutex lock_;
+    std::map<int, long> map_;
+public:
+    static const char* name() { return "shared_mutex map"; }
+    RwLockMap()
+    {
+        for(int key = 0; key < num_keys; key++){
+            map_[key] = key;
+        }
+    }
+    long find(int key) const
+    {
+        std::shared_lock<std::shared_mutex> guard(lock_);
+        auto it = map_.find(key);
+        return (it != map_.end()) ? it->second : 0;
+    }
+    void update(int key, long value)
+    {
+        std::unique_lock<std::shared_mutex> guard(lock_);
+        map_[key] = value;
+    }
+};
+
+/**
+ * @brief copy-on-write map, readers only enter an epoch guard, writers publish
+ * an updated copy and retire the old one
+ */
+class EpochMap{
+    EpochDomain domain_;
+    SpinLock writer_lock_;
+    std::atomic<std::map<int, long>*> map_;
+public:
+    static const char* name() { return "EpochDomain map"; }
+    EpochMap()
+    {
+        std::map<int, long>* map = new std::map<int, long>;
+        for(int key = 0; key < num_keys; key++){
+            (*map)[key] = key;
+        }
+        map_.store(map);
+    }
+    ~EpochMap()
+    {
+        delete map_.load();
+    }
+    long find(int key)
+    {
+        EpochDomain::Guard guard(domain_);
+        const std::map<int, long>* map = map_.load(std::memory_order_acquire);
+        auto it = map->find(key);
+        return (it != map->end()) ? it->second : 0;
+    }
+    void update(int key, long value)
+    {
+        writer_lock_.acquire();
+        std::map<int, long>* map = new std::map<int, long>(*map_.load(std::memory_order_relaxed));
+        (*map)[key] = value;
+        std::map<int, long>* old = map_.exchange(map, std::memory_order_acq_rel);
+        writer_lock_.release();
+        domain_.retire(old);
+    }
+};
+
+/**
+ * @brief measure the cost of an empty read-side critical section on one thread
+ */
+template <typename Enter>
+void run_section(const char* name, Enter&& enter)
+{
+    Timer timer;
+    for(unsigned int r = 0; r < repetitions; r++){
+        timer.start();
+        for(unsigned int i = 0; i < num_sections; i++){
+            enter();
+        }
+        timer.stop();
+    }
+    std::cout << std::setw(20) << name << std::setw(10) << std::fixed << std::setprecision(2)
+              << timer.get_mean_in_ns() / num_sections << std::setw(10)
+              << timer.get_sd_in_ns() / num_sections << "\n";
+}
+
+/**
+ * @brief measure the throughput of threads looking up and rarely updating the map
+ */
+template <typename Map>
+void run(unsigned int num_threads)
+{
+    Timer timer;
+    std::atomic<long> checksum(0);
+    for(unsigned int r = 0; r < repetitions; r++){
+        Map map;
+        std::vector<std::thread> threads;
+        timer.start();
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&, t](){
+                long sum = 0;
+                unsigned int key = t;
+                for(unsigned int i = 0; i < operations_per_thread; i++){
+                    key = key * 1103515245u + 12345u;
+                    if(i % write_period == write_period - 1){
+                        map.update(int(key % num_keys), long(i));
+                    }else{
+                        sum += map.find(int(key % num_keys));
+                    }
+                }
+                checksum += sum;
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        timer.stop();
+    }
+    if(checksum.load() < 0){
+        std::cerr << Map::name() << ": wrong checksum\n";
+    }
+    const std::size_t num_operations = std::size_t(num_threads) * operations_per_thread;
+    std::cout << std::setw(20) << Map::name() << std::setw(9) << num_threads
+              << std::setw(12) << std::fixed << std::setprecision(2)
+              << timer.get_mean_in_MFlop_per_sec(num_operations)
+              << std::setw(10) << timer.get_sd_in_MFlop_per_sec(num_operations) << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int max_threads = std::max(1u, std::thread::hardware_concurrency());
+    if(argc > 1){
+        max_threads = std::max(1, std::atoi(argv[1]));
+    }
+
+    std::cout << "empty read-side critical section\n";
+    std::cout << std::setw(20) << "section" << std::setw(10) << "ns" << std::setw(10) << "sd" << "\n";
+    EpochDomain domain;
+    std::shared_mutex shared_mutex;
+    run_section("EpochDomain::Guard", [&](){ EpochDomain::Guard guard(domain); });
+    run_section("shared_lock", [&](){ std::shared_lock<std::shared_mutex> guard(shared_mutex); });
+
+    std::cout << "\nread-mostly map, 1 update per " << write_period << " operations\n";
+    std::cout << std::setw(20) << "map" << std::setw(9) << "threads"
+              << std::setw(12) << "Mops/s" << std::setw(10) << "sd" << "\n";
+    for(unsigned int num_threads = 1; num_threads <= max_threads; num_threads *= 2){
+        run<EpochMap>(num_threads);
+        run<RwLockMap>(num_threads);
+    }
+    return 0;
+}
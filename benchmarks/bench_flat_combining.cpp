@@ -0,0 +1,133 @@
+/**
+ * @file    : bench_flat_combining.cpp
+ * @brief   : Benchmark of FlatCombiner against SpinLock protected counter and queue
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_flat_combining.exe [max_threads]
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <queue>
+
+#include "../include/FlatCombiner.hpp"
+#include "../include/SpinLock.hpp"
+#include "../include/Timer.hpp"
+
+// operations per thread and measurement
+static const unsigned int ops_per_thread = 200000;
+// number of measurements per configuration
+static const unsigned int repetitions = 3;
+
+/**
+ * @brief counter protected by SpinLock
+ */
+class SpinLockCounter{
+    SpinLock lock_;
+    unsigned long counter_ = 0;
+public:
+    static const char* name() { return "SpinLock counter"; }
+    void operation(unsigned int) { lock_.acquire(); counter_++; lock_.release(); }
+};
+
+/**
+ * @brief counter protected by FlatCombiner
+ */
+class CombinedCounter{
+    FlatCombiner<unsigned long> combiner_{0ul};
+public:
+    static const char* name() { return "FlatCombiner counter"; }
+    void operation(unsigned int) { combiner_.apply([](unsigned long& counter){ counter++; }); }
+};
+
+/**
+ * @brief queue protected by SpinLock, even operations push, odd operations pop
+ */
+class SpinLockQueue{
+    SpinLock lock_;
+    std::queue<unsigned int> queue_;
+public:
+    static const char* name() { return "SpinLock queue"; }
+    void operation(unsigned int i)
+    {
+        lock_.acquire();
+        if(i % 2 == 0){
+            queue_.push(i);
+        }else if(!queue_.empty()){
+            queue_.pop();
+        }
+        lock_.release();
+    }
+};
+
+/**
+ * @brief queue protected by FlatCombiner, even operations push, odd operations pop
+ */
+class CombinedQueue{
+    FlatCombiner<std::queue<unsigned int>> combiner_;
+public:
+    static const char* name() { return "FlatCombiner queue"; }
+    void operation(unsigned int i)
+    {
+        combiner_.apply([i](std::queue<unsigned int>& queue){
+            if(i % 2 == 0){
+                queue.push(i);
+            }else if(!queue.empty()){
+                queue.pop();
+            }
+        });
+    }
+};
+
+/**
+ * @brief measure the throughput of a shared structure for a number of threads
+ */
+template <typename Shared>
+void run(unsigned int num_threads)
+{
+    Timer timer;
+    for(unsigned int r = 0; r < repetitions; r++){
+        Shared shared;
+        std::vector<std::thread> threads;
+        timer.start();
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&](){
+                for(unsigned int i = 0; i < ops_per_thread; i++){
+                    shared.operation(i);
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        timer.stop();
+    }
+    const std::size_t num_operations = std::size_t(num_threads) * ops_per_thread;
+    std::cout << std::setw(22) << Shared::name() << std::setw(9) << num_threads
+              << std::setw(14) << std::fixed << std::setprecision(2)
+              << timer.get_mean_in_MFlop_per_sec(num_operations)
+              << std::setw(12) << timer.get_sd_in_MFlop_per_sec(num_operations) << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int max_threads = std::max(1u, std::thread::hardware_concurrency());
+    if(argc > 1){
+        max_threads = std::max(1, std::atoi(argv[1]));
+    }
+    std::cout << std::setw(22) << "structure" << std::setw(9) << "threads"
+              << std::setw(14) << "Mops/s" << std::setw(12) << "sd" << "\n";
+    for(unsigned int num_threads = 1; num_threads <= max_threads; num_threads *= 2){
+        run<SpinLockCounter>(num_threads);
+        run<CombinedCounter>(num_threads);
+        run<SpinLockQueue>(num_threads);
+        run<CombinedQueue>(num_threads);
+    }
+    return 0;
+}
@@ -0,0 +1,177 @@
+/**
+ * @file    : bench_hashmap.cpp
+ * @brief   : Benchmark of ConcurrentHashMap against std::unordered_map behind
+ * one global lock for read-mostly and mixed workloads
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_hashmap.exe [max_threads]
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+#include "../include/ConcurrentHashMap.hpp"
+#include "../include/SpinLock.hpp"
+#include "../include/FutexLock.hpp"
+#include "../include/Timer.hpp"
+
+// operations per thread and measurement
+static const unsigned int ops_per_thread = 200000;
+// keys in the map, inserted before the measurement
+static const unsigned int num_keys = 1 << 16;
+// number of measurements per configuration
+static const unsigned int repetitions = 3;
+
+/**
+ * @brief shared index as used so far, std::unordered_map behind one lock
+ */
+template <typename Lock>
+class GlobalLockMap{
+    Lock lock_;
+    std::unordered_map<unsigned int, unsigned long> map_;
+public:
+    static const char* name();
+    bool find(unsigned int key, unsigned long& value)
+    {
+        std::lock_guard<Lock> guard(lock_);
+        auto it = map_.find(key);
+        if(it == map_.end()){
+            return false;
+        }
+        value = it->second;
+        return true;
+    }
+    void insert_or_assign(unsigned int key, unsigned long value)
+    {
+        std::lock_guard<Lock> guard(lock_);
+        map_[key] = value;
+    }
+    void erase(unsigned int key)
+    {
+        std::lock_guard<Lock> guard(lock_);
+        map_.erase(key);
+    }
+};
+template <> const char* GlobalLockMap<std::mutex>::name() { return "mutex map"; }
+template <> const char* GlobalLockMap<SpinLock>::name() { return "SpinLock map"; }
+
+/**
+ * @brief std::unordered_map behind one reader-writer lock
+ */
+class SharedMutexMap{
+    std::shared_mutex lock_;
+    std::unordered_map<unsigned int, unsigned long> map_;
+public:
+    static const char* name() { return "shared_mutex map"; }
+    bool find(unsigned int key, unsigned long& value)
+    {
+        std::shared_lock<std::shared_mutex> guard(lock_);
+        auto it = map_.find(key);
+        if(it == map_.end()){
+            return false;
+        }
+        value = it->second;
+        return true;
+    }
+    void insert_or_assign(unsigned int key, unsigned long value)
+    {
+        std::unique_lock<std::shared_mutex> guard(lock_);
+        map_[key] = value;
+    }
+    void erase(unsigned int key)
+    {
+        std::unique_lock<std::shared_mutex> guard(lock_);
+        map_.erase(key);
+    }
+};
+
+/**
+ * @brief ConcurrentHashMap with the name used in the table
+ */
+template <typename Lock>
+class NamedHashMap : public ConcurrentHashMap<unsigned int, unsigned long, Lock>{
+public:
+    static const char* name();
+};
+template <> const char* NamedHashMap<SpinLock>::name() { return "CHM<SpinLock>"; }
+template <> const char* NamedHashMap<FutexLock>::name() { return "CHM<FutexLock>"; }
+
+/**
+ * @brief measure the throughput of threads looking up random keys, a share of
+ * the operations assigns or erases
+ */
+template <typename Map>
+void run(unsigned int num_threads, unsigned int write_percent)
+{
+    Timer timer;
+    std::atomic<unsigned long> checksum(0);
+    for(unsigned int r = 0; r < repetitions; r++){
+        Map map;
+        for(unsigned int key = 0; key < num_keys; key++){
+            map.insert_or_assign(key, key);
+        }
+        std::vector<std::thread> threads;
+        timer.start();
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&, t](){
+                unsigned long sum = 0;
+                unsigned int random = t + 1;
+                for(unsigned int i = 0; i < ops_per_thread; i++){
+                    random = random * 1103515245u + 12345u;
+                    const unsigned int key = (random >> 8) % num_keys;
+                    const unsigned int dice = (random >> 24) % 100;
+                    if(dice < write_percent / 2){
+                        map.erase(key);
+                    }else if(dice < write_percent){
+                        map.insert_or_assign(key, i);
+                    }else{
+                        unsigned long value;
+                        if(map.find(key, value)){
+                            sum += value;
+                        }
+                    }
+                }
+                checksum += sum;
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        timer.stop();
+    }
+    const std::size_t num_operations = std::size_t(num_threads) * ops_per_thread;
+    std::cout << std::setw(18) << Map::name() << std::setw(9) << num_threads << std::setw(9) << write_percent
+              << std::setw(12) << std::fixed << std::setprecision(2)
+              << timer.get_mean_in_MFlop_per_sec(num_operations)
+              << std::setw(10) << timer.get_sd_in_MFlop_per_sec(num_operations) << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int max_threads = std::max(1u, std::thread::hardware_concurrency());
+    if(argc > 1){
+        max_threads = std::max(1, std::atoi(argv[1]));
+    }
+    std::cout << std::setw(18) << "map" << std::setw(9) << "threads" << std::setw(9) << "write %"
+              << std::setw(12) << "Mops/s" << std::setw(10) << "sd" << "\n";
+    for(unsigned int write_percent : {1u, 10u, 50u}){
+        for(unsigned int num_threads = 1; num_threads <= max_threads; num_threads *= 2){
+            run<NamedHashMap<SpinLock>>(num_threads, write_percent);
+            run<NamedHashMap<FutexLock>>(num_threads, write_percent);
+            run<GlobalLockMap<std::mutex>>(num_threads, write_percent);
+            run<GlobalLockMap<SpinLock>>(num_threads, write_percent);
+            run<SharedMutexMap>(num_threads, write_percent);
+        }
+    }
+    return 0;
+}
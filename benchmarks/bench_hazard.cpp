@@ -0,0 +1,172 @@
+/**
+ * @file    : bench_hazard.cpp
+ * @brief   : Benchmark of HazardStack and HazardQueue against SpinLock protected
+ * std::vector and std::deque, also with more threads than CPUs
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_hazard.exe [max_threads]
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <deque>
+#include <atomic>
+
+#include "../include/HazardStack.hpp"
+#include "../include/HazardQueue.hpp"
+#include "../include/SpinLock.hpp"
+#include "../include/Timer.hpp"
+
+// push/pop pairs per thread and measurement
+static const unsigned int pairs_per_thread = 100000;
+// number of measurements per configuration
+static const unsigned int repetitions = 3;
+
+/**
+ * @brief stack as used so far, a std::vector under SpinLock
+ */
+class SpinLockStack{
+    SpinLock lock_;
+    std::vector<unsigned long> values_;
+public:
+    static const char* name() { return "SpinLock stack"; }
+    static HazardDomain* domain() { return nullptr; }
+    void push(unsigned long value)
+    {
+        lock_.acquire();
+        values_.push_back(value);
+        lock_.release();
+    }
+    bool pop(unsigned long& value)
+    {
+        lock_.acquire();
+        const bool found = !values_.empty();
+        if(found){
+            value = values_.back();
+            values_.pop_back();
+        }
+        lock_.release();
+        return found;
+    }
+};
+
+/**
+ * @brief queue as used so far, a std::deque under SpinLock
+ */
+class SpinLockQueue{
+    SpinLock lock_;
+    std::deque<unsigned long> values_;
+public:
+    static const char* name() { return "SpinLock queue"; }
+    static HazardDomain* domain() { return nullptr; }
+    void push(unsigned long value)
+    {
+        lock_.acquire();
+        values_.push_back(value);
+        lock_.release();
+    }
+    bool pop(unsigned long& value)
+    {
+        lock_.acquire();
+        const bool found = !values_.empty();
+        if(found){
+            value = values_.front();
+            values_.pop_front();
+        }
+        lock_.release();
+        return found;
+    }
+};
+
+/**
+ * @brief HazardStack with the name used in the table
+ */
+class NamedHazardStack : public HazardStack<unsigned long>{
+public:
+    static const char* name() { return "HazardStack"; }
+    static HazardDomain* domain() { return &HazardDomain::get_global(); }
+};
+
+/**
+ * @brief HazardQueue with the name used in the table
+ */
+class NamedHazardQueue : public HazardQueue<unsigned long>{
+public:
+    static const char* name() { return "HazardQueue"; }
+    static HazardDomain* domain() { return &HazardDomain::get_global(); }
+};
+
+/**
+ * @brief measure the throughput of threads each pushing and popping in pairs,
+ * reports the retired nodes not yet freed after the run
+ */
+template <typename Container>
+void run(unsigned int num_threads)
+{
+    Timer timer;
+    std::atomic<unsigned long> checksum(0);
+    for(unsigned int r = 0; r < repetitions; r++){
+        Container container;
+        std::vector<std::thread> threads;
+        timer.start();
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&](){
+                unsigned long sum = 0;
+                unsigned long value;
+                for(unsigned int i = 0; i < pairs_per_thread; i++){
+                    container.push(i);
+                    if(container.pop(value)){
+                        sum += value;
+                    }
+                }
+                while(container.pop(value)){
+                    sum += value;
+                }
+                checksum += sum;
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        timer.stop();
+    }
+    const unsigned long expected = 1ul * repetitions * num_threads * pairs_per_thread * (pairs_per_thread - 1) / 2;
+    if(checksum.load() != expected){
+        std::cerr << Container::name() << ": wrong checksum\n";
+    }
+    const std::size_t num_operations = 2 * std::size_t(num_threads) * pairs_per_thread;
+    std::cout << std::setw(16) << Container::name() << std::setw(9) << num_threads
+              << std::setw(12) << std::fixed << std::setprecision(2)
+              << timer.get_mean_in_MFlop_per_sec(num_operations)
+              << std::setw(10) << timer.get_sd_in_MFlop_per_sec(num_operations);
+    if(Container::domain() != nullptr){
+        std::cout << std::setw(10) << Container::domain()->get_num_pending();
+    }else{
+        std::cout << std::setw(10) << "-";
+    }
+    std::cout << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    // twice the CPUs by default, hazard pointers keep memory bounded under preemption
+    unsigned int max_threads = 2 * std::max(1u, std::thread::hardware_concurrency());
+    if(argc > 1){
+        max_threads = std::max(1, std::atoi(argv[1]));
+    }
+    std::cout << std::setw(16) << "container" << std::setw(9) << "threads"
+              << std::setw(12) << "Mops/s" << std::setw(10) << "sd" << std::setw(10) << "pending" << "\n";
+    for(unsigned int num_threads = 1; num_threads <= max_threads; num_threads *= 2){
+        run<NamedHazardStack>(num_threads);
+        run<SpinLockStack>(num_threads);
+        run<NamedHazardQueue>(num_threads);
+        run<SpinLockQueue>(num_threads);
+    }
+    return 0;
+}
@@ -0,0 +1,298 @@
+/**
+ * @file    : bench_locks.cpp
+ * @brief   : Benchmark suite of all locks: throughput, fairness and handover
+ * latency for a sweep of thread counts, critical and non-critical section lengths.
+ * Results are written as JSON to stdout, progress to stderr.
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_locks.exe [--threads=1,2,4] [--cs=0,100,1000] [--ncs=0,1000]
+ *                        [--duration-ms=100] [--no-pin]
+ * cs and ncs are lengths in work iterations (one shared or local increment each)
+ */
+
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <cmath>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+
+#include "../include/SpinLock.hpp"
+#include "../include/AtomicLock.hpp"
+#include "../include/CohortLock.hpp"
+#include "../include/FutexLock.hpp"
+#include "../include/AdaptiveLock.hpp"
+#include "../include/NumaTopology.hpp"
+#include "../include/Timer.hpp"
+
+// maximal number of handover samples per thread
+static const std::size_t max_samples_per_thread = 1 << 16;
+// number of shared cache lines touched in the critical section
+static const std::size_t shared_lines = 8;
+
+/**
+ * @brief benchmark configuration
+ */
+struct Config{
+    std::vector<unsigned int> threads;
+    std::vector<unsigned int> cs_lengths = {0, 100, 1000};
+    std::vector<unsigned int> ncs_lengths = {0, 1000};
+    unsigned int duration_in_ms = 100;
+    bool pin = true;
+};
+
+/**
+ * @brief result of one configuration
+ */
+struct Result{
+    unsigned long acquisitions;
+    double acquisitions_per_sec;
+    double jain_index;
+    double handover_in_ns[4];   //< p50, p90, p99, p99.9
+    std::size_t handovers;
+};
+
+/**
+ * @brief shared state of one run, the critical section data is on own lines
+ */
+struct alignas(CACHE_LINE_SIZE) SharedLine{
+    volatile unsigned long value;
+};
+
+/**
+ * @brief parse a comma separated list of unsigned integers
+ */
+std::vector<unsigned int> parse_list(const std::string& list)
+{
+    std::vector<unsigned int> values;
+    std::stringstream stream(list);
+    std::string value;
+    while(std::getline(stream, value, ',')){
+        values.push_back(std::stoul(value));
+    }
+    return values;
+}
+
+/**
+ * @brief return the CPUs the process may run on
+ */
+std::vector<unsigned int> get_allowed_cpus()
+{
+    std::vector<unsigned int> cpus;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if(sched_getaffinity(0, sizeof(set), &set) == 0){
+        for(unsigned int cpu = 0; cpu < CPU_SETSIZE; cpu++){
+            if(CPU_ISSET(cpu, &set)){
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    if(cpus.empty()){
+        cpus.push_back(0);
+    }
+    return cpus;
+}
+
+/**
+ * @brief pin the calling thread to one CPU
+ */
+void pin_to_cpu(unsigned int cpu)
+{
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+}
+
+/**
+ * @brief return the current time in ns of the Timer clock
+ */
+inline long now_in_ns()
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        high_res_clock::now().time_since_epoch()).count();
+}
+
+/**
+ * @brief run one configuration of a lock
+ */
+template <typename Lock>
+Result run(unsigned int num_threads, unsigned int cs_length, unsigned int ncs_length,
+           const Config& config, const std::vector<unsigned int>& cpus)
+{
+    Lock lock;
+    SharedLine shared[shared_lines] = {};
+    alignas(CACHE_LINE_SIZE) long last_release_in_ns = 0;  //< protected by lock
+    alignas(CACHE_LINE_SIZE) int last_owner = -1;           //< protected by lock
+    std::atomic<unsigned int> ready(0);
+    std::atomic<bool> start(false);
+    std::atomic<bool> stop(false);
+    std::vector<unsigned long> acquisitions(num_threads, 0);
+    std::vector<std::vector<long>> samples(num_threads);
+
+    std::vector<std::thread> threads;
+    for(unsigned int t = 0; t < num_threads; t++){
+        threads.emplace_back([&, t](){
+            if(config.pin){
+                pin_to_cpu(cpus[t % cpus.size()]);
+            }
+            std::vector<long>& local_samples = samples[t];
+            local_samples.reserve(max_samples_per_thread);
+            unsigned long local_acquisitions = 0;
+            volatile unsigned long local_work = 0;
+            ready++;
+            while(!start.load(std::memory_order_acquire)){
+                cpu_relax();
+            }
+            while(!stop.load(std::memory_order_relaxed)){
+                lock.acquire();
+                // handover latency: release by another thread until this acquisition
+                if(last_owner >= 0 && last_owner != int(t) && local_samples.size() < max_samples_per_thread){
+                    local_samples.push_back(now_in_ns() - last_release_in_ns);
+                }
+                for(unsigned int i = 0; i < cs_length; i++){
+                    shared[i % shared_lines].value = shared[i % shared_lines].value + 1;
+                }
+                last_owner = t;
+                last_release_in_ns = now_in_ns();
+                lock.release();
+                local_acquisitions++;
+                for(unsigned int i = 0; i < ncs_length; i++){
+                    local_work = local_work + 1;
+                }
+            }
+            acquisitions[t] = local_acquisitions;
+        });
+    }
+
+    while(ready.load() < num_threads){
+        std::this_thread::yield();
+    }
+    Timer timer;
+    timer.start();
+    start.store(true, std::memory_order_release);
+    std::this_thread::sleep_for(std::chrono::milliseconds(config.duration_in_ms));
+    stop.store(true);
+    for(auto& thread : threads){
+        thread.join();
+    }
+    timer.stop();
+
+    // throughput and Jain's fairness index (sum x)^2 / (n sum x^2)
+    Result result;
+    double sum = 0.;
+    double sum_of_squares = 0.;
+    for(const unsigned long a : acquisitions){
+        sum += a;
+        sum_of_squares += double(a) * a;
+    }
+    result.acquisitions = sum;
+    result.acquisitions_per_sec = sum / timer.get_elapsed_in_sec();
+    result.jain_index = (sum_of_squares > 0.) ? sum * sum / (num_threads * sum_of_squares) : 0.;
+
+    // handover latency percentiles
+    std::vector<long> merged;
+    for(const auto& local_samples : samples){
+        merged.insert(merged.end(), local_samples.begin(), local_samples.end());
+    }
+    std::sort(merged.begin(), merged.end());
+    result.handovers = merged.size();
+    const double percentiles[4] = {0.5, 0.9, 0.99, 0.999};
+    for(unsigned int i = 0; i < 4; i++){
+        result.handover_in_ns[i] = merged.empty() ? 0. :
+            merged[std::min(merged.size() - 1, std::size_t(percentiles[i] * merged.size()))];
+    }
+    return result;
+}
+
+/**
+ * @brief sweep all configurations of a lock and print JSON records
+ */
+template <typename Lock>
+void sweep(const std::string& name, const Config& config, const std::vector<unsigned int>& cpus, bool& first)
+{
+    for(const unsigned int num_threads : config.threads){
+        for(const unsigned int cs_length : config.cs_lengths){
+            for(const unsigned int ncs_length : config.ncs_lengths){
+                std::cerr << name << ": threads=" << num_threads << " cs=" << cs_length
+                          << " ncs=" << ncs_length << "\n";
+                const Result r = run<Lock>(num_threads, cs_length, ncs_length, config, cpus);
+                std::cout << (first ? "\n" : ",\n") << "    {\"lock\": \"" << name << "\""
+                          << ", \"threads\": " << num_threads
+                          << ", \"cs\": " << cs_length
+                          << ", \"ncs\": " << ncs_length
+                          << ", \"acquisitions\": " << r.acquisitions
+                          << ", \"acquisitions_per_sec\": " << r.acquisitions_per_sec
+                          << ", \"jain_index\": " << r.jain_index
+                          << ", \"handovers\": " << r.handovers
+                          << ", \"handover_ns\": {\"p50\": " << r.handover_in_ns[0]
+                          << ", \"p90\": " << r.handover_in_ns[1]
+                          << ", \"p99\": " << r.handover_in_ns[2]
+                          << ", \"p999\": " << r.handover_in_ns[3] << "}}";
+                first = false;
+            }
+        }
+    }
+}
+
+int main(int argc, char* argv[])
+{
+    Config config;
+    for(int i = 1; i < argc; i++){
+        const std::string arg = argv[i];
+        const std::size_t equal = arg.find('=');
+        const std::string key = arg.substr(0, equal);
+        const std::string value = (equal == std::string::npos) ? "" : arg.substr(equal + 1);
+        if(key == "--threads"){
+            config.threads = parse_list(value);
+        }else if(key == "--cs"){
+            config.cs_lengths = parse_list(value);
+        }else if(key == "--ncs"){
+            config.ncs_lengths = parse_list(value);
+        }else if(key == "--duration-ms"){
+            config.duration_in_ms = std::stoul(value);
+        }else if(key == "--no-pin"){
+            config.pin = false;
+        }else{
+            std::cerr << "unknown argument " << arg << "\n";
+            return 1;
+        }
+    }
+
+    // default thread sweep: powers of two up to the number of allowed CPUs
+    const std::vector<unsigned int> cpus = get_allowed_cpus();
+    if(config.threads.empty()){
+        for(unsigned int n = 1; n < cpus.size(); n *= 2){
+            config.threads.push_back(n);
+        }
+        config.threads.push_back(cpus.size());
+    }
+
+    char hostname[256] = "unknown";
+    gethostname(hostname, sizeof(hostname) - 1);
+    std::cout << "{\n  \"host\": {\"name\": \"" << hostname << "\""
+              << ", \"cpus\": " << cpus.size()
+              << ", \"numa_nodes\": " << NumaTopology::get_system().get_num_nodes()
+              << ", \"pinned\": " << (config.pin ? "true" : "false")
+              << ", \"duration_ms\": " << config.duration_in_ms << "},\n"
+              << "  \"results\": [";
+
+    bool first = true;
+    sweep<SpinLock>("SpinLock", config, cpus, first);
+    sweep<AtomicLock>("AtomicLock", config, cpus, first);
+    sweep<CohortLock>("CohortLock", config, cpus, first);
+    sweep<FutexLock>("FutexLock", config, cpus, first);
+    sweep<AdaptiveLock>("AdaptiveLock", config, cpus, first);
+
+    std::cout << "\n  ]\n}\n";
+    return 0;
+}
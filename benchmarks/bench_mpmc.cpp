@@ -0,0 +1,135 @@
+/**
+ * @file    : bench_mpmc.cpp
+ * @brief   : Benchmark of MpmcQueue against a SpinLock protected std::deque
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_mpmc.exe [max_producers]
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <deque>
+
+#include "../include/MpmcQueue.hpp"
+#include "../include/SpinLock.hpp"
+#include "../include/Timer.hpp"
+
+// slots of the bounded queues
+static const std::size_t capacity = 1024;
+// values per producer and measurement
+static const unsigned int values_per_producer = 200000;
+// number of measurements per configuration
+static const unsigned int repetitions = 3;
+
+/**
+ * @brief bounded work queue as used so far, std::deque protected by SpinLock
+ */
+class SpinLockDeque{
+    SpinLock lock_;
+    std::deque<unsigned int> deque_;
+public:
+    static const char* name() { return "SpinLock deque"; }
+    explicit SpinLockDeque(std::size_t) {}
+    bool try_push(unsigned int value)
+    {
+        lock_.acquire();
+        const bool success = deque_.size() < capacity;
+        if(success){
+            deque_.push_back(value);
+        }
+        lock_.release();
+        return success;
+    }
+    bool try_pop(unsigned int& value)
+    {
+        lock_.acquire();
+        const bool success = !deque_.empty();
+        if(success){
+            value = deque_.front();
+            deque_.pop_front();
+        }
+        lock_.release();
+        return success;
+    }
+};
+
+/**
+ * @brief MpmcQueue with the name used in the table
+ */
+class LockFreeQueue : public MpmcQueue<unsigned int>{
+public:
+    static const char* name() { return "MpmcQueue"; }
+    explicit LockFreeQueue(std::size_t capacity) : MpmcQueue<unsigned int>(capacity) {}
+};
+
+/**
+ * @brief measure the throughput with the same number of producers and consumers,
+ * both retry with yield so a shared CPU is handed over
+ */
+template <typename Queue>
+void run(unsigned int num_producers)
+{
+    Timer timer;
+    unsigned long checksum = 0;
+    for(unsigned int r = 0; r < repetitions; r++){
+        Queue queue(capacity);
+        std::atomic<unsigned long> sum(0);
+        std::vector<std::thread> threads;
+        timer.start();
+        for(unsigned int t = 0; t < num_producers; t++){
+            threads.emplace_back([&](){
+                for(unsigned int i = 0; i < values_per_producer; i++){
+                    while(!queue.try_push(i)){
+                        std::this_thread::yield();
+                    }
+                }
+            });
+            threads.emplace_back([&](){
+                unsigned long local_sum = 0;
+                unsigned int value;
+                for(unsigned int i = 0; i < values_per_producer; i++){
+                    while(!queue.try_pop(value)){
+                        std::this_thread::yield();
+                    }
+                    local_sum += value;
+                }
+                sum += local_sum;
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        timer.stop();
+        checksum += sum.load();
+    }
+    const unsigned long expected = 1ul * repetitions * num_producers * values_per_producer * (values_per_producer - 1) / 2;
+    if(checksum != expected){
+        std::cerr << Queue::name() << ": wrong checksum\n";
+    }
+    const std::size_t num_operations = std::size_t(num_producers) * values_per_producer;
+    std::cout << std::setw(16) << Queue::name() << std::setw(11) << num_producers
+              << std::setw(14) << std::fixed << std::setprecision(2)
+              << timer.get_mean_in_MFlop_per_sec(num_operations)
+              << std::setw(12) << timer.get_sd_in_MFlop_per_sec(num_operations) << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int max_producers = std::max(1u, std::thread::hardware_concurrency() / 2);
+    if(argc > 1){
+        max_producers = std::max(1, std::atoi(argv[1]));
+    }
+    std::cout << std::setw(16) << "queue" << std::setw(11) << "producers"
+              << std::setw(14) << "Mvalues/s" << std::setw(12) << "sd" << "\n";
+    for(unsigned int num_producers = 1; num_producers <= max_producers; num_producers *= 2){
+        run<LockFreeQueue>(num_producers);
+        run<SpinLockDeque>(num_producers);
+    }
+    return 0;
+}
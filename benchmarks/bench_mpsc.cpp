@@ -0,0 +1,136 @@
+/**
+ * @file    : bench_mpsc.cpp
+ * @brief   : Benchmark of MpscQueue against a SpinLock protected std::vector for
+ * many producers feeding one aggregating consumer
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_mpsc.exe [max_producers]
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#include "../include/MpscQueue.hpp"
+#include "../include/SpinLock.hpp"
+#include "../include/Timer.hpp"
+
+// records per producer and measurement
+static const unsigned int records_per_producer = 200000;
+// records drained by the consumer per batch
+static const std::size_t batch_size = 256;
+// number of measurements per configuration
+static const unsigned int repetitions = 3;
+
+/**
+ * @brief log record, e.g. a timing sample
+ */
+struct Sample : MpscNode{
+    unsigned long value = 0;
+};
+
+/**
+ * @brief aggregation as used so far, producers append to a std::vector under
+ * SpinLock and the consumer swaps the vector out
+ */
+class SpinLockVector{
+    SpinLock lock_;
+    std::vector<Sample*> records_;
+    std::vector<Sample*> drained_;
+public:
+    static const char* name() { return "SpinLock vector"; }
+    void push(Sample* record)
+    {
+        lock_.acquire();
+        records_.push_back(record);
+        lock_.release();
+    }
+    template <typename Function>
+    std::size_t drain(Function&& consume, std::size_t)
+    {
+        drained_.clear();
+        lock_.acquire();
+        records_.swap(drained_);
+        lock_.release();
+        for(Sample* record : drained_){
+            consume(record);
+        }
+        return drained_.size();
+    }
+};
+
+/**
+ * @brief MpscQueue with the name used in the table
+ */
+class LockFreeQueue : public MpscQueue<Sample>{
+public:
+    static const char* name() { return "MpscQueue"; }
+};
+
+/**
+ * @brief measure the throughput of producers feeding a single consumer
+ */
+template <typename Queue>
+void run(unsigned int num_producers)
+{
+    Timer timer;
+    std::vector<Sample> samples(std::size_t(num_producers) * records_per_producer);
+    unsigned long checksum = 0;
+    for(unsigned int r = 0; r < repetitions; r++){
+        Queue queue;
+        std::vector<std::thread> producers;
+        timer.start();
+        for(unsigned int p = 0; p < num_producers; p++){
+            producers.emplace_back([&, p](){
+                for(unsigned int i = 0; i < records_per_producer; i++){
+                    Sample& sample = samples[std::size_t(p) * records_per_producer + i];
+                    sample.value = i;
+                    queue.push(&sample);
+                }
+            });
+        }
+        const std::size_t num_records = samples.size();
+        std::size_t received = 0;
+        while(received < num_records){
+            const std::size_t count = queue.drain([&](Sample* sample){ checksum += sample->value; }, batch_size);
+            if(count == 0){
+                std::this_thread::yield();
+            }
+            received += count;
+        }
+        for(auto& producer : producers){
+            producer.join();
+        }
+        timer.stop();
+    }
+    const unsigned long expected = 1ul * repetitions * num_producers * records_per_producer * (records_per_producer - 1) / 2;
+    if(checksum != expected){
+        std::cerr << Queue::name() << ": wrong checksum\n";
+    }
+    const std::size_t num_operations = samples.size();
+    std::cout << std::setw(16) << Queue::name() << std::setw(11) << num_producers
+              << std::setw(14) << std::fixed << std::setprecision(2)
+              << timer.get_mean_in_MFlop_per_sec(num_operations)
+              << std::setw(12) << timer.get_sd_in_MFlop_per_sec(num_operations) << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int max_producers = std::max(1u, std::thread::hardware_concurrency());
+    if(argc > 1){
+        max_producers = std::max(1, std::atoi(argv[1]));
+    }
+    std::cout << std::setw(16) << "queue" << std::setw(11) << "producers"
+              << std::setw(14) << "Mrecords/s" << std::setw(12) << "sd" << "\n";
+    for(unsigned int num_producers = 1; num_producers <= max_producers; num_producers *= 2){
+        run<LockFreeQueue>(num_producers);
+        run<SpinLockVector>(num_producers);
+    }
+    return 0;
+}
@@ -0,0 +1,182 @@
+/**
+ * @file    : bench_parallel_for.cpp
+ * @brief   : Benchmark of parallel_for and parallel_reduce against OpenMP on the
+ * array arithmetic of OpenMP_example.c and on an irregular loop
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_parallel_for.exe [array_size]
+ * The OpenMP rows are only measured if the benchmark is built with OpenMP.
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <cmath>
+#include <vector>
+#include <string>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "../include/ParallelFor.hpp"
+#include "../include/Timer.hpp"
+
+// number of measurements per configuration
+static const unsigned int repetitions = 5;
+
+/**
+ * @brief cost of an irregular iteration, grows with the index
+ */
+static double irregular_work(long i, long size)
+{
+    double value = 0.0;
+    const long steps = 1 + 64 * i / size;
+    for(long k = 0; k < steps; k++){
+        value += std::sqrt(double(i + k));
+    }
+    return value;
+}
+
+/**
+ * @brief measure a kernel and print one row
+ */
+template <typename Kernel>
+void run(const std::string& name, long size, Kernel&& kernel)
+{
+    Timer timer;
+    long checksum = 0;
+    // warm-up, starts the workers and touches the memory
+    checksum += kernel();
+    for(unsigned int r = 0; r < repetitions; r++){
+        timer.start();
+        checksum += kernel();
+        timer.stop();
+    }
+    std::cout << std::setw(38) << name << std::setw(14) << std::fixed << std::setprecision(3)
+              << timer.get_mean_in_ns() / 1e6 << std::setw(12) << timer.get_sd_in_ns() / 1e6
+              << std::setw(12) << std::setprecision(1) << timer.get_mean_in_ns() / size
+              << "   (" << checksum << ")\n";
+}
+
+int main(int argc, char* argv[])
+{
+    long size = 1 << 24;
+    if(argc > 1){
+        size = std::max(1, std::atoi(argv[1]));
+    }
+    ThreadPool& pool = ThreadPool::get_global();
+    std::vector<long> A(size);
+#ifdef _OPENMP
+    omp_set_num_threads(pool.get_num_threads());
+#endif
+    std::cout << "threads: " << pool.get_num_threads() << ", array size: " << size << "\n";
+    std::cout << std::setw(38) << "kernel" << std::setw(14) << "mean [ms]" << std::setw(12) << "sd [ms]"
+              << std::setw(12) << "ns/elem" << "\n";
+
+    // array arithmetic of OpenMP_example.c: A[i] = i + 5 * i, sum += A[i]
+    run("sequential reduce", size, [&](){
+        long sum = 0;
+        for(long i = 0; i < size; i++){
+            A[i] = i + i * 5;
+            sum += A[i];
+        }
+        return sum;
+    });
+#ifdef _OPENMP
+    run("omp parallel for reduction", size, [&](){
+        long sum = 0;
+        #pragma omp parallel for reduction(+:sum)
+        for(long i = 0; i < size; i++){
+            A[i] = i + i * 5;
+            sum += A[i];
+        }
+        return sum;
+    });
+#endif
+    const std::pair<const char*, Schedule> schedules[] = {
+        {"static", schedule_static()}, {"static,4096", schedule_static(4096)},
+        {"dynamic,4096", schedule_dynamic(4096)}, {"guided", schedule_guided(1024)}, {"auto", schedule_auto()}
+    };
+    for(const auto& [name, schedule] : schedules){
+        run(std::string("parallel_reduce ") + name, size, [&, schedule = schedule](){
+            return parallel_reduce(0l, size, 0l, [&](long i){
+                A[i] = i + i * 5;
+                return A[i];
+            }, [](long a, long b){ return a + b; }, schedule, pool);
+        });
+    }
+
+    // element-wise loop without reduction
+    run("sequential for", size, [&](){
+        for(long i = 0; i < size; i++){
+            A[i] = A[i] / 3 + i;
+        }
+        return A[size - 1];
+    });
+#ifdef _OPENMP
+    run("omp parallel for static", size, [&](){
+        #pragma omp parallel for schedule(static)
+        for(long i = 0; i < size; i++){
+            A[i] = A[i] / 3 + i;
+        }
+        return A[size - 1];
+    });
+#endif
+    run("parallel_for static", size, [&](){
+        parallel_for(0l, size, [&](long i){ A[i] = A[i] / 3 + i; }, schedule_static(), pool);
+        return A[size - 1];
+    });
+    run("parallel_for_blocks static", size, [&](){
+        parallel_for_blocks(0l, size, [&](long begin, long end){
+            for(long i = begin; i < end; i++){
+                A[i] = A[i] / 3 + i;
+            }
+        }, schedule_static(), pool);
+        return A[size - 1];
+    });
+
+    // irregular loop, the cost per iteration grows with the index
+    const long irregular_size = size / 64;
+#ifdef _OPENMP
+    run("omp irregular static", irregular_size, [&](){
+        double sum = 0.0;
+        #pragma omp parallel for schedule(static) reduction(+:sum)
+        for(long i = 0; i < irregular_size; i++){
+            sum += irregular_work(i, irregular_size);
+        }
+        return long(sum);
+    });
+    run("omp irregular dynamic,64", irregular_size, [&](){
+        double sum = 0.0;
+        #pragma omp parallel for schedule(dynamic, 64) reduction(+:sum)
+        for(long i = 0; i < irregular_size; i++){
+            sum += irregular_work(i, irregular_size);
+        }
+        return long(sum);
+    });
+    run("omp irregular guided", irregular_size, [&](){
+        double sum = 0.0;
+        #pragma omp parallel for schedule(guided) reduction(+:sum)
+        for(long i = 0; i < irregular_size; i++){
+            sum += irregular_work(i, irregular_size);
+        }
+        return long(sum);
+    });
+#endif
+    const std::pair<const char*, Schedule> irregular_schedules[] = {
+        {"static", schedule_static()}, {"dynamic,64", schedule_dynamic(64)},
+        {"guided", schedule_guided()}, {"auto", schedule_auto()}
+    };
+    for(const auto& [name, schedule] : irregular_schedules){
+        run(std::string("parallel_reduce irregular ") + name, irregular_size, [&, schedule = schedule](){
+            return long(parallel_reduce(0l, irregular_size, 0.0, [&](long i){
+                return irregular_work(i, irregular_size);
+            }, [](double a, double b){ return a + b; }, schedule, pool));
+        });
+    }
+    return 0;
+}
@@ -0,0 +1,218 @@
+/**
+ * @file    : bench_percpu.cpp
+ * @brief   : Benchmark of the rseq per-CPU counter and free list against
+ * ShardedCounter, a shared fetch_add and SpinLock protected equivalents
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_percpu.exe [max_threads]
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <atomic>
+
+#include "../include/PerCpuCounter.hpp"
+#include "../include/PerCpuFreeList.hpp"
+#include "../include/ShardedCounter.hpp"
+#include "../include/SpinLock.hpp"
+#include "../include/Timer.hpp"
+
+// operations per thread and measurement
+static const unsigned int ops_per_thread = 1000000;
+// blocks cached per thread in the free list benchmark
+static const unsigned int blocks_per_thread = 64;
+// number of measurements per configuration
+static const unsigned int repetitions = 3;
+
+/**
+ * @brief one shared std::atomic<long> incremented by fetch_add
+ */
+class FetchAddCounter{
+    alignas(CACHE_LINE_SIZE) std::atomic<long> value_{0};
+public:
+    static const char* name() { return "fetch_add"; }
+    void increment() { value_.fetch_add(1, std::memory_order_relaxed); }
+    long get() const { return value_.load(); }
+};
+
+/**
+ * @brief counter as used so far, a long under SpinLock
+ */
+class SpinLockCounter{
+    SpinLock lock_;
+    long value_ = 0;
+public:
+    static const char* name() { return "SpinLock"; }
+    void increment()
+    {
+        lock_.acquire();
+        value_++;
+        lock_.release();
+    }
+    long get() const { return value_; }
+};
+
+/**
+ * @brief ShardedCounter with the name used in the table
+ */
+class NamedShardedCounter : public ShardedCounter<long>{
+public:
+    static const char* name() { return "ShardedCounter"; }
+};
+
+/**
+ * @brief PerCpuCounter with the name used in the table
+ */
+class NamedPerCpuCounter : public PerCpuCounter{
+public:
+    static const char* name() { return "PerCpuCounter"; }
+};
+
+/**
+ * @brief free block
+ */
+struct Block : PerCpuNode{
+    char payload[48];
+};
+
+/**
+ * @brief free list as used so far, an intrusive stack under SpinLock
+ */
+class SpinLockFreeList{
+    SpinLock lock_;
+    PerCpuNode* top_ = nullptr;
+public:
+    static const char* name() { return "SpinLock list"; }
+    void push(Block* block)
+    {
+        lock_.acquire();
+        block->next = top_;
+        top_ = block;
+        lock_.release();
+    }
+    Block* pop()
+    {
+        lock_.acquire();
+        PerCpuNode* top = top_;
+        if(top != nullptr){
+            top_ = top->next;
+        }
+        lock_.release();
+        return static_cast<Block*>(top);
+    }
+};
+
+/**
+ * @brief PerCpuFreeList with the name used in the table
+ */
+class NamedPerCpuFreeList : public PerCpuFreeList<Block>{
+public:
+    static const char* name() { return "PerCpuFreeList"; }
+};
+
+/**
+ * @brief measure the ns per increment while all threads increment one counter
+ */
+template <typename Counter>
+void run_counter(unsigned int num_threads)
+{
+    Timer timer;
+    for(unsigned int r = 0; r < repetitions; r++){
+        Counter counter;
+        std::vector<std::thread> threads;
+        timer.start();
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&](){
+                for(unsigned int i = 0; i < ops_per_thread; i++){
+                    counter.increment();
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        timer.stop();
+        if(counter.get() != long(num_threads) * ops_per_thread){
+            std::cerr << Counter::name() << ": wrong count\n";
+        }
+    }
+    std::cout << std::setw(16) << Counter::name() << std::setw(9) << num_threads
+              << std::setw(12) << std::fixed << std::setprecision(2)
+              << timer.get_mean_in_ns() / ops_per_thread
+              << std::setw(10) << timer.get_sd_in_ns() / ops_per_thread << "\n";
+}
+
+/**
+ * @brief measure the ns per pop/push pair of threads recycling blocks like an
+ * allocator cache, a failed pop allocates from the backing array
+ */
+template <typename FreeList>
+void run_free_list(unsigned int num_threads)
+{
+    Timer timer;
+    std::vector<Block> blocks(std::size_t(num_threads) * blocks_per_thread * 2);
+    std::atomic<std::size_t> next_block(0);
+    for(unsigned int r = 0; r < repetitions; r++){
+        FreeList list;
+        next_block = 0;
+        std::vector<std::thread> threads;
+        timer.start();
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&](){
+                Block* owned[blocks_per_thread];
+                for(unsigned int i = 0; i < ops_per_thread; i += blocks_per_thread){
+                    for(unsigned int b = 0; b < blocks_per_thread; b++){
+                        owned[b] = list.pop();
+                        if(owned[b] == nullptr){
+                            // the backing array holds enough blocks for all threads
+                            const std::size_t index = next_block.fetch_add(1) % blocks.size();
+                            owned[b] = &blocks[index];
+                        }
+                    }
+                    for(unsigned int b = 0; b < blocks_per_thread; b++){
+                        list.push(owned[b]);
+                    }
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        timer.stop();
+    }
+    std::cout << std::setw(16) << FreeList::name() << std::setw(9) << num_threads
+              << std::setw(12) << std::fixed << std::setprecision(2)
+              << timer.get_mean_in_ns() / ops_per_thread
+              << std::setw(10) << timer.get_sd_in_ns() / ops_per_thread << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int max_threads = std::max(1u, std::thread::hardware_concurrency());
+    if(argc > 1){
+        max_threads = std::max(1, std::atoi(argv[1]));
+    }
+    std::cout << "rseq: " << (PerCpuCounter::uses_rseq() ? "yes" : "no (fallback)")
+              << ", CPU slots: " << rseq_get_num_cpus() << "\n";
+    std::cout << std::setw(16) << "counter" << std::setw(9) << "threads"
+              << std::setw(12) << "ns/inc" << std::setw(10) << "sd" << "\n";
+    for(unsigned int num_threads = 1; num_threads <= max_threads; num_threads *= 2){
+        run_counter<NamedPerCpuCounter>(num_threads);
+        run_counter<NamedShardedCounter>(num_threads);
+        run_counter<FetchAddCounter>(num_threads);
+        run_counter<SpinLockCounter>(num_threads);
+    }
+    std::cout << "\n" << std::setw(16) << "free list" << std::setw(9) << "threads"
+              << std::setw(12) << "ns/pair" << std::setw(10) << "sd" << "\n";
+    for(unsigned int num_threads = 1; num_threads <= max_threads; num_threads *= 2){
+        run_free_list<NamedPerCpuFreeList>(num_threads);
+        run_free_list<SpinLockFreeList>(num_threads);
+    }
+    return 0;
+}
@@ -0,0 +1,165 @@
+/**
+ * @file    : bench_seqlock.cpp
+ * @brief   : Benchmark of SeqLock against reader-writer lock and SpinLock
+ * for one writer and many readers and snapshot sizes from 16 B to 4 KB
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <mutex>
+#include <shared_mutex>
+
+#include "../include/SeqLock.hpp"
+#include "../include/SpinLock.hpp"
+#include "../include/Timer.hpp"
+
+// measuring time of one configuration in milliseconds
+static const unsigned int duration_in_ms = 200;
+// pause of the writer between two updates
+static const unsigned int writer_pause = 256;
+
+/**
+ * @brief snapshot of Size bytes, consistent if all words are equal
+ */
+template <std::size_t Size>
+struct Payload{
+    unsigned long words[Size / sizeof(unsigned long)];
+};
+
+/**
+ * @brief SeqLock protected snapshot
+ */
+template <std::size_t Size>
+class SeqLockSnapshot{
+    SeqLock<Payload<Size>> lock_;
+public:
+    static const char* name() { return "SeqLock"; }
+    void store(const Payload<Size>& p) { lock_.store(p); }
+    Payload<Size> load() const { return lock_.load(); }
+};
+
+/**
+ * @brief reader-writer lock protected snapshot
+ */
+template <std::size_t Size>
+class SharedMutexSnapshot{
+    mutable std::shared_mutex lock_;
+    Payload<Size> payload_ = {};
+public:
+    static const char* name() { return "shared_mutex"; }
+    void store(const Payload<Size>& p) { std::unique_lock<std::shared_mutex> g(lock_); payload_ = p; }
+    Payload<Size> load() const { std::shared_lock<std::shared_mutex> g(lock_); return payload_; }
+};
+
+/**
+ * @brief SpinLock protected snapshot
+ */
+template <std::size_t Size>
+class SpinLockSnapshot{
+    mutable SpinLock lock_;
+    Payload<Size> payload_ = {};
+public:
+    static const char* name() { return "SpinLock"; }
+    void store(const Payload<Size>& p) { lock_.acquire(); payload_ = p; lock_.release(); }
+    Payload<Size> load() const { lock_.acquire(); Payload<Size> p = payload_; lock_.release(); return p; }
+};
+
+/**
+ * @brief run one writer and num_readers readers for duration_in_ms
+ */
+template <template <std::size_t> class Snapshot, std::size_t Size>
+void run(unsigned int num_readers)
+{
+    Snapshot<Size> snapshot;
+    std::atomic<bool> done(false);
+    std::atomic<unsigned long> reads(0);
+    std::atomic<unsigned long> torn(0);
+    unsigned long writes = 0;
+
+    Timer timer;
+    timer.start();
+    std::vector<std::thread> readers;
+    for(unsigned int t = 0; t < num_readers; t++){
+        readers.emplace_back([&](){
+            unsigned long local_reads = 0;
+            unsigned long local_torn = 0;
+            while(!done.load(std::memory_order_relaxed)){
+                const Payload<Size> p = snapshot.load();
+                local_torn += (p.words[0] != p.words[Size / sizeof(unsigned long) - 1]);
+                local_reads++;
+            }
+            reads += local_reads;
+            torn += local_torn;
+        });
+    }
+    Timer clock;
+    double elapsed_in_ns = 0.;
+    clock.start();
+    Payload<Size> p;
+    while(true){
+        writes++;
+        for(unsigned long& w : p.words){
+            w = writes;
+        }
+        snapshot.store(p);
+        for(unsigned int i = 0; i < writer_pause; i++){
+            cpu_relax();
+        }
+        // check the clock only every 64 updates
+        if(writes % 64 == 0){
+            clock.stop();
+            elapsed_in_ns += clock.get_elapsed_in_ns();
+            if(elapsed_in_ns > duration_in_ms * 1e6){
+                break;
+            }
+            clock.start();
+        }
+    }
+    done = true;
+    for(auto& reader : readers){
+        reader.join();
+    }
+    timer.stop();
+
+    const double sec = timer.get_elapsed_in_sec();
+    std::cout << std::setw(14) << Snapshot<Size>::name()
+              << std::setw(8) << Size
+              << std::setw(16) << std::fixed << std::setprecision(0) << reads.load() / sec
+              << std::setw(16) << writes / sec
+              << std::setw(8) << torn.load() << "\n";
+}
+
+template <std::size_t Size>
+void run_size(unsigned int num_readers)
+{
+    run<SeqLockSnapshot, Size>(num_readers);
+    run<SharedMutexSnapshot, Size>(num_readers);
+    run<SpinLockSnapshot, Size>(num_readers);
+}
+
+int main(int argc, char* argv[])
+{
+    // number of readers, default: all remaining hardware threads
+    unsigned int num_readers = std::max(1u, std::thread::hardware_concurrency() - 1);
+    if(argc > 1){
+        num_readers = std::max(1, std::atoi(argv[1]));
+    }
+    std::cout << "1 writer, " << num_readers << " readers, "
+              << duration_in_ms << " ms per configuration\n";
+    std::cout << std::setw(14) << "lock" << std::setw(8) << "bytes"
+              << std::setw(16) << "reads/s" << std::setw(16) << "writes/s"
+              << std::setw(8) << "torn" << "\n";
+    run_size<16>(num_readers);
+    run_size<64>(num_readers);
+    run_size<256>(num_readers);
+    run_size<1024>(num_readers);
+    run_size<4096>(num_readers);
+    return 0;
+}
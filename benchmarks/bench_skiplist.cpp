@@ -0,0 +1,152 @@
+/**
+ * @file    : bench_skiplist.cpp
+ * @brief   : Benchmark of SkipList against std::map behind a reader-writer lock
+ * for lookups, updates and range scans of time-indexed events
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_skiplist.exe [max_threads]
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+
+#include "../include/SkipList.hpp"
+#include "../include/Timer.hpp"
+
+// operations per thread and measurement
+static const unsigned int ops_per_thread = 100000;
+// range of the time stamps, half of them are inserted before the measurement
+static const unsigned long num_keys = 1 << 16;
+// length of a range scan in time stamps
+static const unsigned long scan_length = 64;
+// number of measurements per configuration
+static const unsigned int repetitions = 3;
+
+/**
+ * @brief event index as used so far, std::map behind std::shared_mutex
+ */
+class RwLockMap{
+    std::shared_mutex lock_;
+    std::map<unsigned long, unsigned long> map_;
+public:
+    static const char* name() { return "shared_mutex map"; }
+    bool insert(unsigned long key, unsigned long value)
+    {
+        std::unique_lock<std::shared_mutex> guard(lock_);
+        return map_.emplace(key, value).second;
+    }
+    bool erase(unsigned long key)
+    {
+        std::unique_lock<std::shared_mutex> guard(lock_);
+        return map_.erase(key) > 0;
+    }
+    bool find(unsigned long key, unsigned long& value)
+    {
+        std::shared_lock<std::shared_mutex> guard(lock_);
+        auto it = map_.find(key);
+        if(it == map_.end()){
+            return false;
+        }
+        value = it->second;
+        return true;
+    }
+    template <typename Function>
+    std::size_t for_each(unsigned long first, unsigned long last, Function&& function)
+    {
+        std::shared_lock<std::shared_mutex> guard(lock_);
+        std::size_t count = 0;
+        for(auto it = map_.lower_bound(first); it != map_.end() && it->first < last; ++it){
+            function(it->first, it->second);
+            count++;
+        }
+        return count;
+    }
+};
+
+/**
+ * @brief SkipList with the name used in the table
+ */
+class NamedSkipList : public SkipList<unsigned long, unsigned long>{
+public:
+    static const char* name() { return "SkipList"; }
+};
+
+/**
+ * @brief measure the throughput of threads mixing lookups, range scans and
+ * inserts/erases of random time stamps
+ */
+template <typename Map>
+void run(unsigned int num_threads, unsigned int write_percent)
+{
+    Timer timer;
+    std::atomic<unsigned long> checksum(0);
+    for(unsigned int r = 0; r < repetitions; r++){
+        Map map;
+        for(unsigned long key = 0; key < num_keys; key += 2){
+            map.insert(key, key);
+        }
+        std::vector<std::thread> threads;
+        timer.start();
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&, t](){
+                unsigned long sum = 0;
+                unsigned int random = t + 1;
+                for(unsigned int i = 0; i < ops_per_thread; i++){
+                    random = random * 1103515245u + 12345u;
+                    const unsigned long key = (random >> 8) % num_keys;
+                    const unsigned int dice = (random >> 24) % 100;
+                    if(dice < write_percent / 2){
+                        map.erase(key);
+                    }else if(dice < write_percent){
+                        map.insert(key, key);
+                    }else if(dice < write_percent + 10){
+                        map.for_each(key, key + scan_length, [&](unsigned long, unsigned long value){ sum += value; });
+                    }else{
+                        unsigned long value;
+                        if(map.find(key, value)){
+                            sum += value;
+                        }
+                    }
+                }
+                checksum += sum;
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        timer.stop();
+    }
+    const std::size_t num_operations = std::size_t(num_threads) * ops_per_thread;
+    std::cout << std::setw(18) << Map::name() << std::setw(9) << num_threads << std::setw(9) << write_percent
+              << std::setw(12) << std::fixed << std::setprecision(2)
+              << timer.get_mean_in_MFlop_per_sec(num_operations)
+              << std::setw(10) << timer.get_sd_in_MFlop_per_sec(num_operations) << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    unsigned int max_threads = std::max(1u, std::thread::hardware_concurrency());
+    if(argc > 1){
+        max_threads = std::max(1, std::atoi(argv[1]));
+    }
+    std::cout << "10 % range scans of " << scan_length << " time stamps, the rest lookups\n";
+    std::cout << std::setw(18) << "map" << std::setw(9) << "threads" << std::setw(9) << "write %"
+              << std::setw(12) << "Mops/s" << std::setw(10) << "sd" << "\n";
+    for(unsigned int write_percent : {2u, 20u}){
+        for(unsigned int num_threads = 1; num_threads <= max_threads; num_threads *= 2){
+            run<NamedSkipList>(num_threads, write_percent);
+            run<RwLockMap>(num_threads, write_percent);
+        }
+    }
+    return 0;
+}
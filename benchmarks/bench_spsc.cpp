@@ -0,0 +1,140 @@
+/**
+ * @file    : bench_spsc.cpp
+ * @brief   : Benchmark of SpscRingBuffer for single and batch operations against
+ * a SpinLock protected queue
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ *
+ * usage: bench_spsc.exe [values_in_millions]
+ */
+
+#include <iostream>
+#include <iomanip>
+#include <cstdlib>
+#include <thread>
+#include <vector>
+#include <queue>
+
+#include "../include/SpscRingBuffer.hpp"
+#include "../include/SpinLock.hpp"
+#include "../include/Timer.hpp"
+
+// slots of the ring buffer
+static const std::size_t capacity = 1024;
+// number of measurements per configuration
+static const unsigned int repetitions = 3;
+
+/**
+ * @brief queue protected by SpinLock with the batch interface of SpscRingBuffer
+ */
+class SpinLockQueue{
+    SpinLock lock_;
+    std::queue<unsigned long> queue_;
+public:
+    explicit SpinLockQueue(std::size_t) {}
+    std::size_t push(const unsigned long* values, std::size_t count)
+    {
+        lock_.acquire();
+        const std::size_t num_values = std::min(count, capacity - queue_.size());
+        for(std::size_t i = 0; i < num_values; i++){
+            queue_.push(values[i]);
+        }
+        lock_.release();
+        return num_values;
+    }
+    std::size_t pop(unsigned long* values, std::size_t max_count)
+    {
+        lock_.acquire();
+        const std::size_t num_values = std::min(max_count, queue_.size());
+        for(std::size_t i = 0; i < num_values; i++){
+            values[i] = queue_.front();
+            queue_.pop();
+        }
+        lock_.release();
+        return num_values;
+    }
+};
+
+/**
+ * @brief move num_values values from a producer to a consumer thread in batches
+ * @return: unsigned long, checksum of the consumer to keep the loop alive
+ */
+template <typename Queue>
+unsigned long transfer(Queue& queue, std::size_t num_values, std::size_t batch_size)
+{
+    std::thread producer([&](){
+        std::vector<unsigned long> batch(batch_size);
+        std::size_t next = 0;
+        while(next < num_values){
+            const std::size_t count = std::min(batch_size, num_values - next);
+            for(std::size_t i = 0; i < count; i++){
+                batch[i] = next + i;
+            }
+            std::size_t pushed = 0;
+            while(pushed < count){
+                const std::size_t n = queue.push(batch.data() + pushed, count - pushed);
+                if(n == 0){
+                    // full, give the consumer the CPU if it shares it
+                    std::this_thread::yield();
+                }
+                pushed += n;
+            }
+            next += count;
+        }
+    });
+    std::vector<unsigned long> batch(batch_size);
+    unsigned long checksum = 0;
+    std::size_t received = 0;
+    while(received < num_values){
+        const std::size_t n = queue.pop(batch.data(), batch_size);
+        if(n == 0){
+            std::this_thread::yield();
+        }
+        for(std::size_t i = 0; i < n; i++){
+            checksum += batch[i];
+        }
+        received += n;
+    }
+    producer.join();
+    return checksum;
+}
+
+/**
+ * @brief measure the throughput for one batch size
+ */
+template <typename Queue>
+void run(const char* name, std::size_t num_values, std::size_t batch_size)
+{
+    Timer timer;
+    unsigned long checksum = 0;
+    for(unsigned int r = 0; r < repetitions; r++){
+        Queue queue(capacity);
+        timer.start();
+        checksum += transfer(queue, num_values, batch_size);
+        timer.stop();
+    }
+    if(checksum != repetitions * (num_values * (num_values - 1) / 2)){
+        std::cerr << name << ": wrong checksum\n";
+    }
+    std::cout << std::setw(16) << name << std::setw(8) << batch_size
+              << std::setw(14) << std::fixed << std::setprecision(2)
+              << timer.get_mean_in_MFlop_per_sec(num_values)
+              << std::setw(12) << timer.get_sd_in_MFlop_per_sec(num_values) << "\n";
+}
+
+int main(int argc, char* argv[])
+{
+    std::size_t num_values = 4000000;
+    if(argc > 1){
+        num_values = std::size_t(std::max(1, std::atoi(argv[1]))) * 1000000;
+    }
+    std::cout << std::setw(16) << "queue" << std::setw(8) << "batch"
+              << std::setw(14) << "Mops/s" << std::setw(12) << "sd" << "\n";
+    for(std::size_t batch_size : {1, 8, 32, 128}){
+        run<SpscRingBuffer<unsigned long>>("SpscRingBuffer", num_values, batch_size);
+        run<SpinLockQueue>("SpinLock queue", num_values, batch_size);
+    }
+    return 0;
+}
@@ -14,6 +14,7 @@
 #include <thread>
 #include "../include/SpinLock.hpp"
 #include "../include/AtomicLock.hpp"
+#include "../include/FutexLock.hpp"
 
 template<typename Lock>
 void critical_section(int thread_id, Lock& lock) {
@@ -28,11 +29,15 @@ void test_CAS();
 
 void test_TAS();
 
+void test_Futex();
+
 int main() 
 {
     test_CAS();
     std::cout <<  "\n";
     test_TAS();
+    std::cout <<  "\n";
+    test_Futex();
     return 0;
 }
 
@@ -74,3 +79,21 @@ void test_TAS()
     t4.join();
 }
 
+void test_Futex()
+{
+    FutexLock Futex_Lock;   //< initialize futexLock (spin-then-park)
+
+    // test futexLock, waiters sleep instead of burning the CPU for 100 ms
+    printf("\033[1;33mTesting FutexLock based on spin-then-park (futex)!.\033[0m\n");
+
+    std::thread t1(critical_section<FutexLock>, 1, std::ref(Futex_Lock));
+    std::thread t2(critical_section<FutexLock>, 2, std::ref(Futex_Lock));
+    std::thread t3(critical_section<FutexLock>, 3, std::ref(Futex_Lock));
+    std::thread t4(critical_section<FutexLock>, 4, std::ref(Futex_Lock));
+
+    // join all threads
+    t1.join();
+    t2.join();
+    t3.join();
+    t4.join();
+}
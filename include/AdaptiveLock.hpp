@@ -0,0 +1,174 @@
+/**
+ * @file    : AdaptiveLock.hpp
+ * @brief   : Header file of Lock switching between TTAS and queue mode
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef ADAPTIVELOCK_HPP
+#define ADAPTIVELOCK_HPP
+
+#include <thread>   //< allow multi-threading programming
+#include <atomic>   //< allow atomic variables to protect compiler optimization
+#include <chrono>   //< for timed acquisition
+#include "Lockable.hpp"
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: AdaptiveLock
+ * @brief: lock starting as cheap TTAS spin lock. The owner counts contended
+ * acquisitions per window, if contention stays high the lock switches to queue
+ * mode: waiters line up in an MCS queue and only the queue head spins on the
+ * lock word, each waiter spins on its own cache line. If contention drops, the
+ * lock switches back. The lock word is always the true lock, so switching
+ * while threads wait in either mode is safe.
+ */
+class AdaptiveLock
+{
+private:
+    /**
+     * @brief: MCS queue node, lives on the stack of the waiting thread
+     */
+    struct alignas(CACHE_LINE_SIZE) QueueNode{
+        std::atomic<QueueNode*> next{nullptr};  //< successor in the queue
+        std::atomic<bool> waiting{true};        //< false once the node is queue head
+    };
+
+    // switch to queue mode after this many consecutive windows with more than half contended
+    static const unsigned int windows_to_queue_ = 2;
+    // switch to spin mode after this many consecutive windows with less than 1/16 contended
+    static const unsigned int windows_to_spin_ = 4;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<bool> locked_;         //< lock word
+    alignas(CACHE_LINE_SIZE) std::atomic<QueueNode*> tail_;     //< tail of the MCS queue
+    alignas(CACHE_LINE_SIZE) std::atomic<bool> queue_mode_;     //< mode of new waiters
+    unsigned int window_;               //< acquisitions per contention window
+
+    // contention statistics, only accessed by the owner
+    alignas(CACHE_LINE_SIZE) unsigned int window_acquisitions_; //< acquisitions in this window
+    unsigned int window_contended_;     //< contended acquisitions in this window
+    unsigned int high_windows_;         //< consecutive windows with high contention
+    unsigned int low_windows_;          //< consecutive windows with low contention
+    unsigned long mode_switches_;       //< number of mode switches
+
+    /**
+     * @name: spin_on_word()
+     * @brief: TTAS spinning until the lock word is taken
+     */
+    void spin_on_word();
+
+    /**
+     * @name: acquire_queued()
+     * @brief: wait in the MCS queue, then spin on the lock word as queue head
+     */
+    void acquire_queued();
+
+    /**
+     * @name: record()
+     * @brief: update the contention statistics, called by the owner
+     * @param contended: boolean, true if the acquisition had to wait
+     */
+    void record(bool contended);
+
+public:
+
+    /**
+     * @name: AdaptiveLock()
+     * @brief: Default Constructor
+     * @param window: number of acquisitions per contention window
+     */
+    explicit AdaptiveLock(unsigned int window = 256);
+
+    /**
+     * @name: AdaptiveLock()
+     * @brief: Copy Constructor is deleted, queued waiters refer to the lock
+     */
+    AdaptiveLock(const AdaptiveLock& adaptiveLock)=delete;
+
+    /**
+     * @name: AdaptiveLock()
+     * @brief: Default Destructor
+     */
+    ~AdaptiveLock()=default;
+
+    /**
+     * @name: acquire()
+     * @brief: lock the adaptive lock before entering critical region
+     */
+    void acquire();
+
+    /**
+     * @name: release()
+     * @brief: unlock the adaptive lock before leaving critical region
+     */
+    void release();
+
+    /**
+     * @name: try_acquire()
+     * @brief: try to lock the adaptive lock once without waiting
+     * @return: boolean, true if the lock was acquired
+     */
+    bool try_acquire();
+
+    /**
+     * @name: lock()
+     * @brief: Lockable interface, same as acquire()
+     */
+    void lock();
+
+    /**
+     * @name: unlock()
+     * @brief: Lockable interface, same as release()
+     */
+    void unlock();
+
+    /**
+     * @name: try_lock()
+     * @brief: Lockable interface, same as try_acquire()
+     * @return: boolean, true if the lock was acquired
+     */
+    bool try_lock();
+
+    /**
+     * @name: try_lock_for()
+     * @brief: spin on the lock for at most the given duration
+     * @param duration: maximal waiting time
+     * @return: boolean, true if the lock was acquired
+     */
+    template <typename Rep, typename Period>
+    bool try_lock_for(const std::chrono::duration<Rep, Period>& duration)
+    {
+        return try_lock_until(std::chrono::steady_clock::now() + duration);
+    }
+
+    /**
+     * @name: try_lock_until()
+     * @brief: spin on the lock until the deadline passed
+     * @param deadline: time point after which the attempt is abandoned
+     * @return: boolean, true if the lock was acquired
+     */
+    template <typename Clock, typename Duration>
+    bool try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline)
+    {
+        return spin_try_acquire_until(*this, deadline);
+    }
+
+    /**
+     * @name: is_queue_mode()
+     * @brief: return the mode of new waiters
+     * @return: boolean, true if waiters line up in the MCS queue
+     */
+    bool is_queue_mode() const;
+
+    /**
+     * @name: get_mode_switches()
+     * @brief: return the number of mode switches, read by the owner
+     * @return: unsigned long, number of mode switches
+     */
+    unsigned long get_mode_switches() const;
+
+}; // class AdaptiveLock
+
+#endif // ADAPTIVELOCK_HPP
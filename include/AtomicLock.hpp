@@ -12,6 +12,8 @@
 
 #include <thread>   //< allow multi-threading programming
 #include <atomic>   //< allow atomic variables to protect compiler optimization
+#include <chrono>   //< for timed acquisition
+#include "Lockable.hpp"
 
 /**
  * @name: TAS() - test-and-set
@@ -64,6 +66,56 @@ public:
      */
     void release();
 
+    /**
+     * @name: try_acquire()
+     * @brief: try to lock the TAS lock once without waiting
+     * @return: boolean, true if the lock was acquired
+     */
+    bool try_acquire();
+
+    /**
+     * @name: lock()
+     * @brief: Lockable interface, same as acquire()
+     */
+    void lock();
+
+    /**
+     * @name: unlock()
+     * @brief: Lockable interface, same as release()
+     */
+    void unlock();
+
+    /**
+     * @name: try_lock()
+     * @brief: Lockable interface, same as try_acquire()
+     * @return: boolean, true if the lock was acquired
+     */
+    bool try_lock();
+
+    /**
+     * @name: try_lock_for()
+     * @brief: spin on the lock for at most the given duration
+     * @param duration: maximal waiting time
+     * @return: boolean, true if the lock was acquired
+     */
+    template <typename Rep, typename Period>
+    bool try_lock_for(const std::chrono::duration<Rep, Period>& duration)
+    {
+        return try_lock_until(std::chrono::steady_clock::now() + duration);
+    }
+
+    /**
+     * @name: try_lock_until()
+     * @brief: spin on the lock until the deadline passed
+     * @param deadline: time point after which the attempt is abandoned
+     * @return: boolean, true if the lock was acquired
+     */
+    template <typename Clock, typename Duration>
+    bool try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline)
+    {
+        return spin_try_acquire_until(*this, deadline);
+    }
+
 }; // class AtomicLock
 
 #endif // TASLOCK_HPP
\ No newline at end of file
@@ -0,0 +1,336 @@
+/**
+ * @file    : AtomicPrimitives.hpp
+ * @brief   : Header file of memory-order-aware atomic primitives and
+ * double-width compare-and-swap (DWCAS)
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef ATOMICPRIMITIVES_HPP
+#define ATOMICPRIMITIVES_HPP
+
+#include <atomic>   //< for std::memory_order
+#include <cstdint>  //< for uint64_t
+
+// The primitives operate on plain memory like CAS() and TAS(), but take explicit
+// memory orders instead of always being full barriers. The values of
+// std::memory_order equal the __ATOMIC_* constants of the GCC builtins.
+
+/**
+ * @name: get_failure_order()
+ * @brief: return the strongest valid failure order of a CAS for a success order
+ * @param success: memory order if the CAS succeeds
+ * @return: std::memory_order, memory order if the CAS fails
+ */
+constexpr std::memory_order get_failure_order(std::memory_order success)
+{
+    return (success == std::memory_order_acq_rel) ? std::memory_order_acquire :
+           (success == std::memory_order_release) ? std::memory_order_relaxed : success;
+}
+
+/**
+ * @name: get_success_order()
+ * @brief: return a success order of a CAS which is at least as strong as its
+ * failure order, e.g. release with an acquire failure becomes acq_rel, so the
+ * ordering requested for a failed CAS is never dropped
+ * @param success: requested memory order if the CAS succeeds
+ * @param failure: requested memory order if the CAS fails
+ * @return: std::memory_order, memory order if the CAS succeeds
+ */
+constexpr std::memory_order get_success_order(std::memory_order success, std::memory_order failure)
+{
+    // a failed CAS only loads, get_failure_order() reduces release and acq_rel to their load part
+    const std::memory_order load = get_failure_order(failure);
+    if(success == std::memory_order_seq_cst || load == std::memory_order_seq_cst){
+        return std::memory_order_seq_cst;
+    }
+    if(load == std::memory_order_relaxed){
+        return success;
+    }
+    // acquire or consume, which compilers promote to acquire
+    return (success == std::memory_order_release || success == std::memory_order_acq_rel) ?
+           std::memory_order_acq_rel : (success == std::memory_order_relaxed) ? load : success;
+}
+
+/**
+ * @name: atomic_load()
+ * @brief: atomic load of a word
+ * @param value: pointer to the memory
+ * @param order: relaxed, acquire or seq_cst
+ * @return: T, loaded value
+ */
+template <typename T>
+inline T atomic_load(const T* value, std::memory_order order = std::memory_order_seq_cst)
+{
+    return __atomic_load_n(value, int(order));
+}
+
+/**
+ * @name: atomic_store()
+ * @brief: atomic store of a word
+ * @param value: pointer to the memory
+ * @param new_val: stored value
+ * @param order: relaxed, release or seq_cst
+ */
+template <typename T>
+inline void atomic_store(T* value, T new_val, std::memory_order order = std::memory_order_seq_cst)
+{
+    __atomic_store_n(value, new_val, int(order));
+}
+
+/**
+ * @name: atomic_exchange()
+ * @brief: atomic swap of a word
+ * @param value: pointer to the memory
+ * @param new_val: stored value
+ * @param order: memory order of the read-modify-write
+ * @return: T, old value
+ */
+template <typename T>
+inline T atomic_exchange(T* value, T new_val, std::memory_order order = std::memory_order_seq_cst)
+{
+    return __atomic_exchange_n(value, new_val, int(order));
+}
+
+/**
+ * @name: atomic_cas() - compare-and-swap (strong)
+ * @brief: store new_val if the memory equals expected, never fails spuriously
+ * @param value: pointer to the memory
+ * @param expected: reference value, overwritten with the current value on failure
+ * @param new_val: stored value on success
+ * @param success: memory order if the memory was modified, raised to cover failure
+ * @param failure: memory order if the memory was not modified
+ * @return: boolean, true if the memory was modified
+ */
+template <typename T>
+inline bool atomic_cas(T* value, T& expected, T new_val,
+                       std::memory_order success = std::memory_order_seq_cst,
+                       std::memory_order failure = std::memory_order_seq_cst)
+{
+    // release and acq_rel are invalid failure orders, only their load part applies
+    return __atomic_compare_exchange_n(value, &expected, new_val, false, int(get_success_order(success, failure)),
+                                       int(get_failure_order(failure)));
+}
+
+/**
+ * @name: atomic_cas_weak() - compare-and-swap (weak)
+ * @brief: like atomic_cas() but may fail spuriously, cheaper inside retry loops
+ * on LL/SC architectures
+ * @param value: pointer to the memory
+ * @param expected: reference value, overwritten with the current value on failure
+ * @param new_val: stored value on success
+ * @param success: memory order if the memory was modified, raised to cover failure
+ * @param failure: memory order if the memory was not modified
+ * @return: boolean, true if the memory was modified
+ */
+template <typename T>
+inline bool atomic_cas_weak(T* value, T& expected, T new_val,
+                            std::memory_order success = std::memory_order_seq_cst,
+                            std::memory_order failure = std::memory_order_seq_cst)
+{
+    // release and acq_rel are invalid failure orders, only their load part applies
+    return __atomic_compare_exchange_n(value, &expected, new_val, true, int(get_success_order(success, failure)),
+                                       int(get_failure_order(failure)));
+}
+
+/**
+ * @name: atomic_tas() - test-and-set
+ * @brief: set a flag to true and return its old value
+ * @param flag: pointer to the flag
+ * @param order: memory order of the read-modify-write, acquire for locks
+ * @return: boolean, old value of the flag
+ */
+inline bool atomic_tas(bool* flag, std::memory_order order = std::memory_order_seq_cst)
+{
+    return __atomic_exchange_n(flag, true, int(order));
+}
+
+/**
+ * @name: atomic_clear()
+ * @brief: set a flag to false
+ * @param flag: pointer to the flag
+ * @param order: memory order of the store, release for locks
+ */
+inline void atomic_clear(bool* flag, std::memory_order order = std::memory_order_seq_cst)
+{
+    __atomic_store_n(flag, false, int(order));
+}
+
+/**
+ * @name: atomic_fetch_add()
+ * @brief: atomic addition
+ * @param value: pointer to the memory
+ * @param operand: added value
+ * @param order: memory order of the read-modify-write
+ * @return: T, old value
+ */
+template <typename T>
+inline T atomic_fetch_add(T* value, T operand, std::memory_order order = std::memory_order_seq_cst)
+{
+    return __atomic_fetch_add(value, operand, int(order));
+}
+
+/**
+ * @name: atomic_fetch_sub()
+ * @brief: atomic subtraction
+ * @param value: pointer to the memory
+ * @param operand: subtracted value
+ * @param order: memory order of the read-modify-write
+ * @return: T, old value
+ */
+template <typename T>
+inline T atomic_fetch_sub(T* value, T operand, std::memory_order order = std::memory_order_seq_cst)
+{
+    return __atomic_fetch_sub(value, operand, int(order));
+}
+
+/**
+ * @name: atomic_fetch_and()
+ * @brief: atomic bitwise and
+ * @param value: pointer to the memory
+ * @param operand: mask
+ * @param order: memory order of the read-modify-write
+ * @return: T, old value
+ */
+template <typename T>
+inline T atomic_fetch_and(T* value, T operand, std::memory_order order = std::memory_order_seq_cst)
+{
+    return __atomic_fetch_and(value, operand, int(order));
+}
+
+/**
+ * @name: atomic_fetch_or()
+ * @brief: atomic bitwise or
+ * @param value: pointer to the memory
+ * @param operand: mask
+ * @param order: memory order of the read-modify-write
+ * @return: T, old value
+ */
+template <typename T>
+inline T atomic_fetch_or(T* value, T operand, std::memory_order order = std::memory_order_seq_cst)
+{
+    return __atomic_fetch_or(value, operand, int(order));
+}
+
+/**
+ * @name: atomic_fetch_xor()
+ * @brief: atomic bitwise exclusive or
+ * @param value: pointer to the memory
+ * @param operand: mask
+ * @param order: memory order of the read-modify-write
+ * @return: T, old value
+ */
+template <typename T>
+inline T atomic_fetch_xor(T* value, T operand, std::memory_order order = std::memory_order_seq_cst)
+{
+    return __atomic_fetch_xor(value, operand, int(order));
+}
+
+/**
+ * @name: DoubleWord
+ * @brief: 16 byte aligned pair of words for DWCAS, e.g. pointer and version counter
+ */
+struct alignas(16) DoubleWord{
+    uint64_t low;   //< first word, e.g. pointer
+    uint64_t high;  //< second word, e.g. tag or version counter
+
+    bool operator==(const DoubleWord& other) const { return low == other.low && high == other.high; }
+    bool operator!=(const DoubleWord& other) const { return !(*this == other); }
+};
+
+/**
+ * @name: detect_native_dwcas()
+ * @brief: query the CPU for a lock-free 16 byte CAS, called once for native_dwcas
+ * @return: boolean, true if dwcas() is lock-free
+ */
+bool detect_native_dwcas();
+
+/**
+ * @name: native_dwcas
+ * @brief: true if the CPU supports a lock-free 16 byte CAS (cmpxchg16b on x86-64).
+ * Known at compile time if the target guarantees it (e.g. -mcx16), otherwise
+ * detected once with cpuid during static initialization, before any object
+ * defined after this header, so dwcas() only tests a constant.
+ */
+#if defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+inline constexpr bool native_dwcas = true;
+#else
+inline const bool native_dwcas = detect_native_dwcas();
+#endif
+
+/**
+ * @name: has_native_dwcas()
+ * @brief: return if the CPU supports a lock-free 16 byte CAS
+ * @return: boolean, true if dwcas() is lock-free
+ */
+inline bool has_native_dwcas()
+{
+    return native_dwcas;
+}
+
+/**
+ * @name: dwcas_locked()
+ * @brief: DWCAS emulated with a striped lock table, used without native support
+ * @param value: pointer to the 16 byte aligned memory
+ * @param expected: reference value, overwritten with the current value on failure
+ * @param new_val: stored value on success
+ * @return: boolean, true if the memory was modified
+ */
+bool dwcas_locked(DoubleWord* value, DoubleWord& expected, DoubleWord new_val);
+
+/**
+ * @name: dwcas() - double-width compare-and-swap
+ * @brief: store new_val if both words equal expected, sequentially consistent.
+ * Without native support all accesses of the location must use dwcas() and
+ * dw_load(), since the emulation is lock-based.
+ * @param value: pointer to the 16 byte aligned memory
+ * @param expected: reference value, overwritten with the current value on failure
+ * @param new_val: stored value on success
+ * @return: boolean, true if the memory was modified
+ */
+inline bool dwcas(DoubleWord* value, DoubleWord& expected, DoubleWord new_val)
+{
+#if defined(__x86_64__)
+    if(__builtin_expect(native_dwcas, 1)){
+        bool success;
+        asm volatile("lock cmpxchg16b %1"
+                     : "=@ccz"(success), "+m"(*value), "+a"(expected.low), "+d"(expected.high)
+                     : "b"(new_val.low), "c"(new_val.high)
+                     : "memory");
+        return success;
+    }
+#elif defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+    unsigned __int128* memory = reinterpret_cast<unsigned __int128*>(value);
+    const unsigned __int128 old_val = (unsigned __int128)expected.high << 64 | expected.low;
+    const unsigned __int128 current = __sync_val_compare_and_swap(
+        memory, old_val, (unsigned __int128)new_val.high << 64 | new_val.low);
+    if(current == old_val){
+        return true;
+    }
+    expected.low = uint64_t(current);
+    expected.high = uint64_t(current >> 64);
+    return false;
+#endif
+    return dwcas_locked(value, expected, new_val);
+}
+
+/**
+ * @name: dw_load()
+ * @brief: atomic load of both words, implemented with dwcas(). The CAS writes
+ * even if it fails, so every load takes the cache line exclusive like a store
+ * and concurrent readers of the location contend with each other. Read-mostly
+ * data should be read through single-word loads where a torn pair is tolerable.
+ * @param value: pointer to the 16 byte aligned, writable memory
+ * @return: DoubleWord, current value
+ */
+inline DoubleWord dw_load(DoubleWord* value)
+{
+    DoubleWord expected = {0, 0};
+    // stores {0, 0} only if the memory already equals it
+    dwcas(value, expected, expected);
+    return expected;
+}
+
+#endif // ATOMICPRIMITIVES_HPP
@@ -0,0 +1,212 @@
+/**
+ * @file    : Barrier.hpp
+ * @brief   : Header file of scalable barriers: centralized sense-reversing,
+ * dissemination and tournament barrier
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef BARRIER_HPP
+#define BARRIER_HPP
+
+#include <atomic>   //< allow atomic variables to protect compiler optimization
+#include <cstdint>  //< for uint32_t
+#include <memory>   //< for std::unique_ptr
+#include "concurrency_utils.hpp"
+
+// All barriers are for a fixed number of threads, every thread passes its own
+// id in [0, num_threads) to arrive_and_wait(). Waiting threads spin with
+// exponentially growing pause loops and yield the CPU once the backoff is
+// saturated, so oversubscribed threads still make progress.
+
+/**
+ * @name: SenseBarrier
+ * @brief: centralized sense-reversing barrier. Every thread decrements a shared
+ * counter, the last one resets it and flips the shared sense, all others spin
+ * on the sense. O(1) memory and the lowest latency for few threads, but every
+ * arrival hits the same cache line.
+ */
+class SenseBarrier
+{
+private:
+    /**
+     * @brief: sense of a thread, padded to avoid false sharing
+     */
+    struct alignas(CACHE_LINE_SIZE) LocalSense{
+        bool sense; //< value of the shared sense at the end of the current episode
+    };
+
+    unsigned int num_threads_;                                  //< number of participating threads
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> count_;     //< threads still to arrive
+    alignas(CACHE_LINE_SIZE) std::atomic<bool> sense_;         //< flipped by the last thread
+    std::unique_ptr<LocalSense[]> local_senses_;                //< sense of every thread
+
+public:
+
+    /**
+     * @name: SenseBarrier()
+     * @brief: Constructor
+     * @param num_threads: number of participating threads, at least one
+     */
+    explicit SenseBarrier(unsigned int num_threads);
+
+    /**
+     * @name: SenseBarrier()
+     * @brief: Copy Constructor is deleted, waiting threads refer to the barrier
+     */
+    SenseBarrier(const SenseBarrier& senseBarrier)=delete;
+
+    /**
+     * @name: ~SenseBarrier()
+     * @brief: Default Destructor
+     */
+    ~SenseBarrier()=default;
+
+    /**
+     * @name: arrive_and_wait()
+     * @brief: block until all threads arrived
+     * @param thread_id: id of the calling thread in [0, num_threads)
+     */
+    void arrive_and_wait(unsigned int thread_id);
+
+    /**
+     * @name: get_num_threads()
+     * @brief: return the number of participating threads
+     * @return: unsigned int, number of threads
+     */
+    unsigned int get_num_threads() const;
+
+}; // class SenseBarrier
+
+/**
+ * @name: DisseminationBarrier
+ * @brief: dissemination barrier of Hensgen, Finkel and Manber. In round r
+ * thread i signals thread (i + 2^r) mod n and waits for the signal of thread
+ * (i - 2^r) mod n, after ceil(log2 n) rounds every thread transitively heard of
+ * all others. No shared counter, every flag has a single writer and a single
+ * reader, but O(n log n) signals per episode. The flags hold the episode number
+ * instead of a sense, so they never need to be reset.
+ */
+class DisseminationBarrier
+{
+private:
+    // enough rounds for 2^32 threads
+    static const unsigned int max_rounds_ = 32;
+
+    /**
+     * @brief: flags a thread waits on and its episode counter
+     */
+    struct alignas(CACHE_LINE_SIZE) Node{
+        std::atomic<uint32_t> flags[max_rounds_];   //< last episode signaled in each round
+        uint32_t episode;                           //< current episode of the owner
+    };
+
+    unsigned int num_threads_;      //< number of participating threads
+    unsigned int num_rounds_;       //< ceil(log2(num_threads_))
+    std::unique_ptr<Node[]> nodes_; //< node of every thread
+
+public:
+
+    /**
+     * @name: DisseminationBarrier()
+     * @brief: Constructor
+     * @param num_threads: number of participating threads, at least one
+     */
+    explicit DisseminationBarrier(unsigned int num_threads);
+
+    /**
+     * @name: DisseminationBarrier()
+     * @brief: Copy Constructor is deleted, waiting threads refer to the barrier
+     */
+    DisseminationBarrier(const DisseminationBarrier& disseminationBarrier)=delete;
+
+    /**
+     * @name: ~DisseminationBarrier()
+     * @brief: Default Destructor
+     */
+    ~DisseminationBarrier()=default;
+
+    /**
+     * @name: arrive_and_wait()
+     * @brief: block until all threads arrived
+     * @param thread_id: id of the calling thread in [0, num_threads)
+     */
+    void arrive_and_wait(unsigned int thread_id);
+
+    /**
+     * @name: get_num_threads()
+     * @brief: return the number of participating threads
+     * @return: unsigned int, number of threads
+     */
+    unsigned int get_num_threads() const;
+
+}; // class DisseminationBarrier
+
+/**
+ * @name: TournamentBarrier
+ * @brief: tournament barrier with statically determined winners. In round r
+ * thread i with i mod 2^(r+1) = 2^r loses against thread i - 2^r: it signals
+ * the winner and sleeps until it is woken. The champion (thread 0) wins all
+ * rounds and starts the wake-up, every woken thread wakes the threads it beat.
+ * Only n - 1 arrival signals per episode and every flag is spun on by a single
+ * thread, which suits machines without coherent broadcast.
+ */
+class TournamentBarrier
+{
+private:
+    // enough rounds for 2^32 threads
+    static const unsigned int max_rounds_ = 32;
+
+    /**
+     * @brief: flags a thread waits on and its episode counter
+     */
+    struct alignas(CACHE_LINE_SIZE) Node{
+        std::atomic<uint32_t> arrivals[max_rounds_];    //< last episode the loser of a round arrived
+        std::atomic<uint32_t> wakeup;                   //< last episode the thread was woken
+        uint32_t episode;                               //< current episode of the owner
+    };
+
+    unsigned int num_threads_;      //< number of participating threads
+    unsigned int num_rounds_;       //< ceil(log2(num_threads_))
+    std::unique_ptr<Node[]> nodes_; //< node of every thread
+
+public:
+
+    /**
+     * @name: TournamentBarrier()
+     * @brief: Constructor
+     * @param num_threads: number of participating threads, at least one
+     */
+    explicit TournamentBarrier(unsigned int num_threads);
+
+    /**
+     * @name: TournamentBarrier()
+     * @brief: Copy Constructor is deleted, waiting threads refer to the barrier
+     */
+    TournamentBarrier(const TournamentBarrier& tournamentBarrier)=delete;
+
+    /**
+     * @name: ~TournamentBarrier()
+     * @brief: Default Destructor
+     */
+    ~TournamentBarrier()=default;
+
+    /**
+     * @name: arrive_and_wait()
+     * @brief: block until all threads arrived
+     * @param thread_id: id of the calling thread in [0, num_threads)
+     */
+    void arrive_and_wait(unsigned int thread_id);
+
+    /**
+     * @name: get_num_threads()
+     * @brief: return the number of participating threads
+     * @return: unsigned int, number of threads
+     */
+    unsigned int get_num_threads() const;
+
+}; // class TournamentBarrier
+
+#endif // BARRIER_HPP
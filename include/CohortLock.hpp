@@ -0,0 +1,146 @@
+/**
+ * @file    : CohortLock.hpp
+ * @brief   : Header file of NUMA-aware hierarchical cohort lock
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef COHORTLOCK_HPP
+#define COHORTLOCK_HPP
+
+#include <thread>   //< allow multi-threading programming
+#include <atomic>   //< allow atomic variables to protect compiler optimization
+#include <memory>   //< for std::unique_ptr
+#include <chrono>   //< for timed acquisition
+#include "Lockable.hpp"
+#include "NumaTopology.hpp"
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: CohortLock
+ * @brief: lock with one local lock per NUMA node under a global lock. The owner
+ * passes the global lock directly to a waiter of the same node (the cohort)
+ * up to max_batch times in a row, before releasing it to the other nodes.
+ */
+class CohortLock
+{
+private:
+    /**
+     * @brief: per-node lock state on its own cache line
+     */
+    struct alignas(CACHE_LINE_SIZE) LocalLock{
+        std::atomic<bool> locked{false};        //< local lock state
+        std::atomic<unsigned int> waiters{0};   //< threads waiting for the local lock
+        bool owns_global = false;               //< cohort holds the global lock
+        unsigned int batch = 0;                 //< consecutive local handovers
+    };
+
+    alignas(CACHE_LINE_SIZE) std::atomic<bool> global_locked_;  //< global lock state
+    NumaTopology topology_;                 //< CPU to node mapping
+    std::unique_ptr<LocalLock[]> locals_;   //< one local lock per node
+    unsigned int max_batch_;                //< bound of consecutive local handovers
+    unsigned int owner_node_;               //< node of the current owner
+
+public:
+
+    /**
+     * @name: CohortLock()
+     * @brief: Constructor for the topology of this machine
+     * @param max_batch: maximal number of consecutive handovers within a node
+     */
+    explicit CohortLock(unsigned int max_batch = 64);
+
+    /**
+     * @name: CohortLock()
+     * @brief: Constructor for a given topology
+     * @param topology: CPU to NUMA node mapping
+     * @param max_batch: maximal number of consecutive handovers within a node
+     */
+    CohortLock(const NumaTopology& topology, unsigned int max_batch = 64);
+
+    /**
+     * @name: CohortLock()
+     * @brief: Copy Constructor is deleted, waiters refer to the lock state
+     */
+    CohortLock(const CohortLock& cohortLock)=delete;
+
+    /**
+     * @name: CohortLock()
+     * @brief: Default Destructor
+     */
+    ~CohortLock()=default;
+
+    /**
+     * @name: acquire()
+     * @brief: lock the cohort lock before entering critical region
+     */
+    void acquire();
+
+    /**
+     * @name: release()
+     * @brief: unlock the cohort lock before leaving critical region
+     */
+    void release();
+
+    /**
+     * @name: try_acquire()
+     * @brief: try to lock the cohort lock once without waiting
+     * @return: boolean, true if the lock was acquired
+     */
+    bool try_acquire();
+
+    /**
+     * @name: lock()
+     * @brief: Lockable interface, same as acquire()
+     */
+    void lock();
+
+    /**
+     * @name: unlock()
+     * @brief: Lockable interface, same as release()
+     */
+    void unlock();
+
+    /**
+     * @name: try_lock()
+     * @brief: Lockable interface, same as try_acquire()
+     * @return: boolean, true if the lock was acquired
+     */
+    bool try_lock();
+
+    /**
+     * @name: try_lock_for()
+     * @brief: spin on the lock for at most the given duration
+     * @param duration: maximal waiting time
+     * @return: boolean, true if the lock was acquired
+     */
+    template <typename Rep, typename Period>
+    bool try_lock_for(const std::chrono::duration<Rep, Period>& duration)
+    {
+        return try_lock_until(std::chrono::steady_clock::now() + duration);
+    }
+
+    /**
+     * @name: try_lock_until()
+     * @brief: spin on the lock until the deadline passed
+     * @param deadline: time point after which the attempt is abandoned
+     * @return: boolean, true if the lock was acquired
+     */
+    template <typename Clock, typename Duration>
+    bool try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline)
+    {
+        return spin_try_acquire_until(*this, deadline);
+    }
+
+    /**
+     * @name: get_num_nodes()
+     * @brief: return the number of local locks
+     * @return: unsigned int, number of NUMA nodes
+     */
+    unsigned int get_num_nodes() const;
+
+}; // class CohortLock
+
+#endif // COHORTLOCK_HPP
@@ -0,0 +1,482 @@
+/**
+ * @file    : ConcurrentHashMap.hpp
+ * @brief   : Header file of concurrent open-addressing hash map with lock
+ * striping and optimistic seqlock reads
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef CONCURRENTHASHMAP_HPP
+#define CONCURRENTHASHMAP_HPP
+
+#include <thread>       //< for std::this_thread::yield
+#include <atomic>       //< allow atomic variables to protect compiler optimization
+#include <cstddef>      //< for std::size_t
+#include <cstdint>      //< for uint8_t and uint64_t
+#include <cstring>      //< for std::memcpy
+#include <functional>   //< for std::hash
+#include <memory>       //< for std::unique_ptr
+#include <type_traits>  //< for std::is_trivially_copyable
+#include <utility>      //< for std::pair
+#include <vector>       //< for the tables of a segment
+#include "Lockable.hpp"
+#include "SpinLock.hpp"
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: ConcurrentHashMap
+ * @brief: hash map with linear probing, split into NumSegments segments by the
+ * high bits of the hash. Each segment has its own table, a lock of type Lock
+ * serializing its writers and a version number like SeqLock. Writers make the
+ * version odd while they modify the table, readers never write shared memory:
+ * they probe the table optimistically and retry if the version changed. The
+ * slots are stored as relaxed atomic words, so the racy reads are well defined.
+ * A segment grows on its own when it is 3/4 full. The keys are copied into a
+ * new table which readers cannot see yet, then the table pointer is swapped,
+ * so readers keep probing the old table meanwhile and retry at most once. The
+ * migration is not incremental: the writers of the growing segment wait
+ * O(segment size) on its lock, the other segments are not affected. Pass the
+ * expected number of keys to the constructor to avoid growth. The smaller
+ * tables are kept until the map is destroyed, since readers may still probe
+ * them, which at most doubles the memory. Erased slots become tombstones,
+ * which are cleared in place when they fill a segment; only then the readers
+ * of the segment wait for the rehash. Key and Value must be trivially copyable.
+ */
+template <typename Key, typename Value, LibraryLock Lock = SpinLock, std::size_t NumSegments = 64,
+          typename Hash = std::hash<Key>>
+class ConcurrentHashMap
+{
+    static_assert(std::is_trivially_copyable<Key>::value && std::is_trivially_copyable<Value>::value,
+                  "ConcurrentHashMap requires trivially copyable keys and values");
+    static_assert(NumSegments > 0 && (NumSegments & (NumSegments - 1)) == 0,
+                  "ConcurrentHashMap needs a power of two of segments");
+
+private:
+    // number of failed reads before the reader gives the writer its CPU
+    static constexpr unsigned int spins_before_yield_ = 64;
+    // number of hash bits selecting the segment
+    static constexpr unsigned int segment_bits_ = __builtin_ctzll(NumSegments);
+
+    /**
+     * @brief: trivially copyable value stored as relaxed atomic words
+     */
+    template <typename T>
+    struct Words{
+        static constexpr std::size_t num_words = (sizeof(T) + sizeof(std::size_t) - 1) / sizeof(std::size_t);
+        std::atomic<std::size_t> words[num_words];
+
+        void store(const T& value)
+        {
+            std::size_t buffer[num_words] = {};
+            std::memcpy(buffer, &value, sizeof(T));
+            for(std::size_t i = 0; i < num_words; i++){
+                words[i].store(buffer[i], std::memory_order_relaxed);
+            }
+        }
+        T load() const
+        {
+            std::size_t buffer[num_words];
+            for(std::size_t i = 0; i < num_words; i++){
+                buffer[i] = words[i].load(std::memory_order_relaxed);
+            }
+            T value;
+            std::memcpy(&value, buffer, sizeof(T));
+            return value;
+        }
+    };
+
+    // states of a slot
+    enum : uint8_t { EMPTY, FULL, DELETED };
+
+    /**
+     * @brief: slot of the open-addressing table
+     */
+    struct Slot{
+        std::atomic<uint8_t> state;     //< EMPTY, FULL or DELETED
+        Words<Key> key;                 //< key if not EMPTY
+        Words<Value> value;             //< value if FULL
+    };
+
+    /**
+     * @brief: table of a segment, the capacity is a power of two
+     */
+    struct Table{
+        std::size_t capacity;               //< number of slots
+        std::unique_ptr<Slot[]> slots;      //< slots
+
+        explicit Table(std::size_t num_slots) : capacity(num_slots), slots(new Slot[num_slots])
+        {
+            for(std::size_t i = 0; i < capacity; i++){
+                slots[i].state.store(EMPTY, std::memory_order_relaxed);
+            }
+        }
+    };
+
+    /**
+     * @brief: segment padded to full cache lines
+     */
+    struct alignas(CACHE_LINE_SIZE) Segment{
+        Lock lock;                                  //< serializes the writers
+        std::atomic<unsigned long> version;         //< odd while a writer modifies the table
+        std::atomic<Table*> table;                  //< current table
+        std::atomic<std::size_t> size;              //< number of FULL slots
+        std::size_t num_deleted;                    //< number of DELETED slots, writers only
+        std::vector<std::unique_ptr<Table>> tables; //< current and all smaller tables, writers only
+    };
+
+    Segment segments_[NumSegments]; //< segments
+    Hash hash_;                     //< hash function of the keys
+
+    /**
+     * @name: get_hash()
+     * @brief: return the scrambled hash of a key, identity hashes leave the high
+     * bits empty, the Fibonacci multiplication spreads them
+     * @param key: key
+     * @return: uint64_t, high bits select the segment, low bits the slot
+     */
+    uint64_t get_hash(const Key& key) const
+    {
+        const uint64_t mixed = uint64_t(hash_(key)) * 0x9E3779B97F4A7C15ull;
+        return mixed ^ (mixed >> 32);
+    }
+
+    /**
+     * @name: get_segment()
+     * @brief: return the segment of a hash
+     * @param hash: scrambled hash
+     * @return: Segment&, segment of the key
+     */
+    Segment& get_segment(uint64_t hash)
+    {
+        return segments_[(hash >> (63 - segment_bits_) >> 1) & (NumSegments - 1)];
+    }
+
+    /**
+     * @name: get_segment()
+     * @brief: return the segment of a hash for readers
+     * @param hash: scrambled hash
+     * @return: const Segment&, segment of the key
+     */
+    const Segment& get_segment(uint64_t hash) const
+    {
+        return segments_[(hash >> (63 - segment_bits_) >> 1) & (NumSegments - 1)];
+    }
+
+    /**
+     * @name: find_slot()
+     * @brief: probe a table for a key
+     * @param table: probed table, may be modified concurrently by optimistic readers
+     * @param hash: scrambled hash of the key
+     * @param key: searched key
+     * @return: Slot*, FULL slot of the key or nullptr
+     */
+    static Slot* find_slot(Table* table, uint64_t hash, const Key& key)
+    {
+        const std::size_t mask = table->capacity - 1;
+        for(std::size_t i = 0; i < table->capacity; i++){
+            Slot& slot = table->slots[(hash + i) & mask];
+            const uint8_t state = slot.state.load(std::memory_order_relaxed);
+            if(state == EMPTY){
+                return nullptr;
+            }
+            if(state == FULL && slot.key.load() == key){
+                return &slot;
+            }
+        }
+        return nullptr;
+    }
+
+    /**
+     * @name: begin_write()
+     * @brief: make the version of a locked segment odd before modifying its table
+     * @param segment: locked segment to modify
+     */
+    static void begin_write(Segment& segment)
+    {
+        segment.version.store(segment.version.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        // the fence keeps the table stores behind the version store
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    /**
+     * @name: end_write()
+     * @brief: make the version of a locked segment even after modifying its table
+     * @param segment: modified segment
+     */
+    static void end_write(Segment& segment)
+    {
+        segment.version.store(segment.version.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @name: insert_new()
+     * @brief: store a key which is not in the table into the first free slot
+     * @param table: table with at least one free slot
+     * @param hash: scrambled hash of the key
+     * @param key: new key
+     * @param value: value of the key
+     * @return: boolean, true if a tombstone was reused
+     */
+    static bool insert_new(Table* table, uint64_t hash, const Key& key, const Value& value)
+    {
+        const std::size_t mask = table->capacity - 1;
+        for(std::size_t i = 0; ; i++){
+            Slot& slot = table->slots[(hash + i) & mask];
+            const uint8_t state = slot.state.load(std::memory_order_relaxed);
+            if(state != FULL){
+                slot.key.store(key);
+                slot.value.store(value);
+                slot.state.store(FULL, std::memory_order_relaxed);
+                return state == DELETED;
+            }
+        }
+    }
+
+    /**
+     * @name: reserve_slot()
+     * @brief: make sure a segment has room for one more key, the caller holds
+     * the segment lock. Grows the table if it is half full with keys, else
+     * clears the tombstones in place. Both rehash the whole segment.
+     * @param segment: locked segment
+     */
+    void reserve_slot(Segment& segment)
+    {
+        Table* table = segment.table.load(std::memory_order_relaxed);
+        const std::size_t size = segment.size.load(std::memory_order_relaxed);
+        if(4 * (size + segment.num_deleted + 1) <= 3 * table->capacity){
+            return;
+        }
+        if(2 * (size + 1) > table->capacity){
+            // fill the new table before readers can see it, they keep probing the old one
+            Table* grown = new Table(2 * table->capacity);
+            segment.tables.emplace_back(grown);
+            for(std::size_t i = 0; i < table->capacity; i++){
+                Slot& slot = table->slots[i];
+                if(slot.state.load(std::memory_order_relaxed) == FULL){
+                    const Key key = slot.key.load();
+                    insert_new(grown, get_hash(key), key, slot.value.load());
+                }
+            }
+            begin_write(segment);
+            segment.table.store(grown, std::memory_order_release);
+            segment.num_deleted = 0;
+            end_write(segment);
+            return;
+        }
+        // tombstones are cleared in place, readers of the table retry meanwhile
+        std::vector<std::pair<Key, Value>> entries;
+        entries.reserve(size);
+        for(std::size_t i = 0; i < table->capacity; i++){
+            if(table->slots[i].state.load(std::memory_order_relaxed) == FULL){
+                entries.emplace_back(table->slots[i].key.load(), table->slots[i].value.load());
+            }
+        }
+        begin_write(segment);
+        for(std::size_t i = 0; i < table->capacity; i++){
+            table->slots[i].state.store(EMPTY, std::memory_order_relaxed);
+        }
+        for(const auto& entry : entries){
+            insert_new(table, get_hash(entry.first), entry.first, entry.second);
+        }
+        segment.num_deleted = 0;
+        end_write(segment);
+    }
+
+    /**
+     * @name: put()
+     * @brief: insert a key or assign its value
+     * @param key: key
+     * @param value: value of the key
+     * @param assign: overwrite the value of an existing key
+     * @return: boolean, true if the key was inserted
+     */
+    bool put(const Key& key, const Value& value, bool assign)
+    {
+        const uint64_t hash = get_hash(key);
+        Segment& segment = get_segment(hash);
+        segment.lock.acquire();
+        // readers only retry if the table is modified
+        Slot* slot = find_slot(segment.table.load(std::memory_order_relaxed), hash, key);
+        if(slot != nullptr){
+            if(assign){
+                begin_write(segment);
+                slot->value.store(value);
+                end_write(segment);
+            }
+            segment.lock.release();
+            return false;
+        }
+        reserve_slot(segment);
+        begin_write(segment);
+        if(insert_new(segment.table.load(std::memory_order_relaxed), hash, key, value)){
+            segment.num_deleted--;
+        }
+        segment.size.store(segment.size.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        end_write(segment);
+        segment.lock.release();
+        return true;
+    }
+
+public:
+
+    /**
+     * @name: ConcurrentHashMap()
+     * @brief: Constructor
+     * @param capacity: expected number of keys, the tables grow beyond it
+     * @param hash: hash function of the keys
+     */
+    explicit ConcurrentHashMap(std::size_t capacity = 0, const Hash& hash = Hash())
+        : hash_(hash)
+    {
+        // tables of at least 8 slots, room for the expected keys below 1/2 load
+        std::size_t slots_per_segment = 8;
+        while(slots_per_segment * NumSegments < 2 * capacity){
+            slots_per_segment *= 2;
+        }
+        for(Segment& segment : segments_){
+            segment.version.store(0, std::memory_order_relaxed);
+            segment.tables.emplace_back(new Table(slots_per_segment));
+            segment.table.store(segment.tables.back().get(), std::memory_order_relaxed);
+            segment.size.store(0, std::memory_order_relaxed);
+            segment.num_deleted = 0;
+        }
+    }
+
+    /**
+     * @name: ConcurrentHashMap()
+     * @brief: Copy Constructor is deleted, the segments are shared by the threads
+     */
+    ConcurrentHashMap(const ConcurrentHashMap& concurrentHashMap)=delete;
+
+    /**
+     * @name: insert()
+     * @brief: insert a key if it is not in the map
+     * @param key: key
+     * @param value: value of the key
+     * @return: boolean, false if the key was already in the map, its value is kept
+     */
+    bool insert(const Key& key, const Value& value)
+    {
+        return put(key, value, false);
+    }
+
+    /**
+     * @name: insert_or_assign()
+     * @brief: insert a key or overwrite its value
+     * @param key: key
+     * @param value: value of the key
+     * @return: boolean, true if the key was inserted, false if assigned
+     */
+    bool insert_or_assign(const Key& key, const Value& value)
+    {
+        return put(key, value, true);
+    }
+
+    /**
+     * @name: erase()
+     * @brief: remove a key
+     * @param key: key
+     * @return: boolean, false if the key was not in the map
+     */
+    bool erase(const Key& key)
+    {
+        const uint64_t hash = get_hash(key);
+        Segment& segment = get_segment(hash);
+        segment.lock.acquire();
+        Slot* slot = find_slot(segment.table.load(std::memory_order_relaxed), hash, key);
+        if(slot != nullptr){
+            begin_write(segment);
+            slot->state.store(DELETED, std::memory_order_relaxed);
+            segment.num_deleted++;
+            segment.size.store(segment.size.load(std::memory_order_relaxed) - 1, std::memory_order_relaxed);
+            end_write(segment);
+        }
+        segment.lock.release();
+        return slot != nullptr;
+    }
+
+    /**
+     * @name: find()
+     * @brief: look up a key without writing shared memory, retries while a
+     * writer modifies the segment
+     * @param key: key
+     * @param value: output, overwritten only if the key was found
+     * @return: boolean, true if the key was found
+     */
+    bool find(const Key& key, Value& value) const
+    {
+        const uint64_t hash = get_hash(key);
+        const Segment& segment = get_segment(hash);
+        unsigned int spins = 0;
+        while(true){
+            const unsigned long version = segment.version.load(std::memory_order_acquire);
+            if((version & 1) == 0){
+                Slot* slot = find_slot(segment.table.load(std::memory_order_acquire), hash, key);
+                Value result{};
+                if(slot != nullptr){
+                    result = slot->value.load();
+                }
+                // the fence keeps the table loads in front of the validation
+                std::atomic_thread_fence(std::memory_order_acquire);
+                if(segment.version.load(std::memory_order_relaxed) == version){
+                    if(slot != nullptr){
+                        value = result;
+                    }
+                    return slot != nullptr;
+                }
+            }
+            if(++spins < spins_before_yield_){
+                cpu_relax();
+            }else{
+                // the writer might be preempted in the middle of an update
+                std::this_thread::yield();
+                spins = 0;
+            }
+        }
+    }
+
+    /**
+     * @name: contains()
+     * @brief: return if a key is in the map
+     * @param key: key
+     * @return: boolean, true if the key was found
+     */
+    bool contains(const Key& key) const
+    {
+        Value value;
+        return find(key, value);
+    }
+
+    /**
+     * @name: size()
+     * @brief: return the number of keys, a snapshot under concurrency
+     * @return: std::size_t, number of keys
+     */
+    std::size_t size() const
+    {
+        std::size_t size = 0;
+        for(const Segment& segment : segments_){
+            size += segment.size.load(std::memory_order_relaxed);
+        }
+        return size;
+    }
+
+    /**
+     * @name: get_capacity()
+     * @brief: return the number of slots of the current tables, a snapshot under concurrency
+     * @return: std::size_t, number of slots
+     */
+    std::size_t get_capacity() const
+    {
+        std::size_t capacity = 0;
+        for(const Segment& segment : segments_){
+            capacity += segment.table.load(std::memory_order_acquire)->capacity;
+        }
+        return capacity;
+    }
+
+}; // class ConcurrentHashMap
+
+#endif // CONCURRENTHASHMAP_HPP
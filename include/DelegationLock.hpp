@@ -0,0 +1,241 @@
+/**
+ * @file    : DelegationLock.hpp
+ * @brief   : Header file of delegation lock, a server thread executes the critical sections
+ * @author  : David Blickenstorfer
+ *
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef DELEGATIONLOCK_HPP
+#define DELEGATIONLOCK_HPP
+
+#include <thread>       //< allow multi-threading programming
+#include <atomic>       //< allow atomic variables to protect compiler optimization
+#include <cstdint>      //< for uint32_t
+#include <type_traits>  //< for std::invoke_result_t
+#include <utility>      //< for std::forward
+#ifdef __linux__
+#include <pthread.h>    //< for pthread_setaffinity_np
+#include <sched.h>      //< for cpu_set_t
+#endif
+#include "Futex.hpp"
+#include "PublicationSlots.hpp"
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: DelegationLock
+ * @brief: protect a shared object T by delegation. Clients publish their
+ * critical section in a per-client request slot on its own cache line, a
+ * dedicated server thread executes the published critical sections one after
+ * the other. The shared object never leaves the cache of the server, only the
+ * request slots move between cores. The server parks on a futex when idle.
+ */
+template <typename T, std::size_t NumSlots = 64>
+class DelegationLock
+{
+private:
+    // number of busy-wait iterations before yielding the CPU
+    static const unsigned int spins_before_yield_ = 128;
+    // number of empty server passes before the server parks
+    static const unsigned int passes_before_park_ = 4096;
+
+    alignas(CACHE_LINE_SIZE) T data_;               //< shared object, touched by the server only
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> sleeping_;  //< 1 while the server parks
+    std::atomic<bool> stopping_;                    //< set by the destructor
+    PublicationSlots<T, NumSlots> slots_;           //< request slots
+    std::atomic<unsigned long> passes_;             //< number of non-empty server passes, written by the server
+    std::atomic<unsigned long> served_;             //< number of executed requests, written by the server
+    std::thread server_;                            //< server thread, started last
+
+    /**
+     * @name: serve_pass()
+     * @brief: execute all published requests once, called by the server
+     * @return: std::size_t, number of executed requests
+     */
+    std::size_t serve_pass()
+    {
+        const std::size_t served = slots_.for_each_request([this](Request<T>& request){
+            request.run(data_);
+            served_.store(served_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        });
+        if(served > 0){
+            passes_.store(passes_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        }
+        return served;
+    }
+
+    /**
+     * @name: serve()
+     * @brief: main loop of the server thread, spin, then yield, then park
+     * while no requests are published
+     */
+    void serve()
+    {
+        unsigned int idle = 0;
+        while(true){
+            if(serve_pass() > 0){
+                idle = 0;
+            }else if(stopping_.load(std::memory_order_acquire)){
+                return;
+            }else if(++idle < spins_before_yield_){
+                cpu_relax();
+            }else if(idle < passes_before_park_){
+                // leave the CPU to the clients
+                std::this_thread::yield();
+            }else{
+                // announce the sleep before the last check, pairs with notify()
+                sleeping_.store(1, std::memory_order_seq_cst);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                if(serve_pass() == 0 && !stopping_.load(std::memory_order_acquire)){
+                    futex_wait(&sleeping_, 1);
+                }
+                sleeping_.store(0, std::memory_order_relaxed);
+                idle = 0;
+            }
+        }
+    }
+
+    /**
+     * @name: notify()
+     * @brief: wake up the server if it parks, called after publishing
+     */
+    void notify()
+    {
+        if(sleeping_.load(std::memory_order_seq_cst) != 0 &&
+           sleeping_.exchange(0, std::memory_order_seq_cst) != 0){
+            futex_wake(&sleeping_, 1);
+        }
+    }
+
+    /**
+     * @name: execute()
+     * @brief: publish a request and wait until the server executed it
+     * @param request: request of the calling thread
+     */
+    void execute(Request<T>& request)
+    {
+        // nested call from a critical section, the server executes it directly
+        if(std::this_thread::get_id() == server_.get_id()){
+            request.run(data_);
+            return;
+        }
+
+        // claim the slot, it is only busy if shared with another client
+        typename PublicationSlots<T, NumSlots>::Slot& slot = slots_.get_slot();
+        unsigned int spins = 0;
+        while(!slots_.try_publish(slot, request, std::memory_order_seq_cst)){
+            if(++spins < spins_before_yield_){
+                cpu_relax();
+            }else{
+                // reduce CPU contention
+                std::this_thread::yield();
+                spins = 0;
+            }
+        }
+        notify();
+
+        spins = 0;
+        while(slots_.is_pending(slot, request)){
+            if(++spins < spins_before_yield_){
+                cpu_relax();
+            }else{
+                // leave the CPU to the server
+                std::this_thread::yield();
+                spins = 0;
+            }
+        }
+    }
+
+public:
+
+    /**
+     * @name: DelegationLock()
+     * @brief: Constructor, starts the server thread
+     * @param args: constructor arguments of the shared object
+     */
+    template <typename... Args>
+    explicit DelegationLock(Args&&... args) : data_(std::forward<Args>(args)...)
+    {
+        sleeping_ = 0;
+        stopping_ = false;
+        passes_ = 0;
+        served_ = 0;
+        server_ = std::thread([this](){ serve(); });
+    }
+
+    /**
+     * @name: DelegationLock()
+     * @brief: Copy Constructor is deleted, the server refers to the slots
+     */
+    DelegationLock(const DelegationLock& delegationLock)=delete;
+
+    /**
+     * @name: ~DelegationLock()
+     * @brief: Destructor, stops the server thread, no client may wait anymore
+     */
+    ~DelegationLock()
+    {
+        stopping_.store(true, std::memory_order_seq_cst);
+        notify();
+        server_.join();
+    }
+
+    /**
+     * @name: apply()
+     * @brief: execute a critical section on the shared object by the server
+     * thread, apply() only returns when it is done
+     * @param operation: callable with signature R(T&)
+     * @return: R, result of the operation
+     */
+    template <typename Operation>
+    std::invoke_result_t<Operation&, T&> apply(Operation&& operation)
+    {
+        return apply_request<T>(operation, [this](Request<T>& request){ execute(request); });
+    }
+
+    /**
+     * @name: pin_server()
+     * @brief: bind the server thread to a CPU, e.g. next to the clients
+     * sharing its last level cache
+     * @param cpu: unsigned int, CPU number of the server
+     * @return: boolean, true if the affinity was set
+     */
+    bool pin_server(unsigned int cpu)
+    {
+#ifdef __linux__
+        cpu_set_t set;
+        CPU_ZERO(&set);
+        CPU_SET(cpu, &set);
+        return pthread_setaffinity_np(server_.native_handle(), sizeof(set), &set) == 0;
+#else
+        (void)cpu;
+        return false;
+#endif
+    }
+
+    /**
+     * @name: get_passes()
+     * @brief: return the number of server passes executing at least one request
+     * @return: unsigned long, number of non-empty server passes
+     */
+    unsigned long get_passes() const { return passes_.load(std::memory_order_relaxed); }
+
+    /**
+     * @name: get_served()
+     * @brief: return the number of critical sections executed by the server
+     * @return: unsigned long, number of served requests
+     */
+    unsigned long get_served() const { return served_.load(std::memory_order_relaxed); }
+
+    /**
+     * @name: get_unsafe()
+     * @brief: return the shared object without synchronization, only valid
+     * while no client applies operations
+     * @return: T&, shared object
+     */
+    T& get_unsafe() { return data_; }
+
+}; // class DelegationLock
+
+#endif // DELEGATIONLOCK_HPP
@@ -0,0 +1,238 @@
+/**
+ * @file    : EpochDomain.hpp
+ * @brief   : Header file of epoch-based memory reclamation (EBR) for lock-free
+ * data structures
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef EPOCHDOMAIN_HPP
+#define EPOCHDOMAIN_HPP
+
+#include <atomic>   //< allow atomic variables to protect compiler optimization
+#include <cstddef>  //< for std::size_t
+#include <cstdint>  //< for uint64_t
+#include <vector>   //< for the limbo lists
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: EpochDomain
+ * @brief: epoch-based reclamation of Fraser. Readers of a lock-free structure
+ * hold a Guard, which publishes the global epoch in the record of the thread.
+ * Unlinked nodes are retired into the limbo list of the epoch they were retired
+ * in and freed once the global epoch advanced twice, since no guard can still
+ * see them then. The epoch only advances when all active guards observed the
+ * current one, so reading costs one store and one fence per guard. A thread
+ * stalling inside a guard blocks all frees, memory then grows without bound.
+ * Thread records are created on first use and reused after the thread exits,
+ * their pending nodes are inherited by the next owner.
+ */
+class EpochDomain
+{
+private:
+    // limbo lists per thread, nodes of epoch e are in list e % num_limbo_lists_
+    static const unsigned int num_limbo_lists_ = 3;
+    // epoch of a thread record outside of any guard
+    static const uint64_t inactive_ = UINT64_MAX;
+
+    /**
+     * @brief: retired node with its type-erased deleter
+     */
+    struct Retired{
+        void* pointer;              //< unlinked node
+        void (*deleter)(void*);     //< frees the node
+    };
+
+public:
+    /**
+     * @brief: per-thread state, linked into the list of the domain and never freed before it
+     */
+    struct alignas(CACHE_LINE_SIZE) ThreadRecord{
+        std::atomic<uint64_t> epoch;                    //< pinned epoch or inactive_
+        std::atomic<bool> in_use;                       //< owned by a living thread
+        ThreadRecord* next;                             //< next record, immutable once published
+        unsigned int nesting;                           //< depth of nested guards, owner only
+        std::size_t num_retired;                        //< retired since the last collection, owner only
+        uint64_t limbo_epochs[num_limbo_lists_];        //< retire epoch of each limbo list, owner only
+        std::vector<Retired> limbo[num_limbo_lists_];   //< retired nodes, owner only
+    };
+
+    /**
+     * @name: Guard
+     * @brief: RAII critical region of a reader, nodes reachable inside stay
+     * allocated until the guard is destroyed. Guards may be nested.
+     */
+    class Guard
+    {
+    private:
+        EpochDomain& domain_;   //< guarded domain
+        ThreadRecord* record_;  //< record of the calling thread
+
+    public:
+        /**
+         * @name: Guard()
+         * @brief: Constructor, enter the critical region
+         * @param domain: guarded domain, the global domain by default
+         */
+        explicit Guard(EpochDomain& domain = EpochDomain::get_global());
+
+        /**
+         * @name: Guard()
+         * @brief: Copy Constructor is deleted, a guard belongs to its thread
+         */
+        Guard(const Guard& guard)=delete;
+
+        /**
+         * @name: ~Guard()
+         * @brief: Destructor, leave the critical region
+         */
+        ~Guard();
+
+        /**
+         * @name: retire()
+         * @brief: free a node once no guard can reach it, see EpochDomain::retire()
+         * @param node: pointer to the unlinked node, allocated with new
+         */
+        template <typename T>
+        void retire(T* node)
+        {
+            domain_.retire(node);
+        }
+
+    }; // class Guard
+
+private:
+    uint64_t id_;                                               //< unique id, tells domains at reused addresses apart
+    std::size_t retire_batch_;                                  //< retired nodes between two collections
+    alignas(CACHE_LINE_SIZE) std::atomic<uint64_t> epoch_;     //< global epoch
+    alignas(CACHE_LINE_SIZE) std::atomic<ThreadRecord*> records_;  //< list of thread records
+    std::atomic<uint64_t> num_freed_;                           //< number of freed nodes
+
+    /**
+     * @name: get_record()
+     * @brief: return the record of the calling thread, claim or create it on first use
+     * @return: ThreadRecord*, record owned by the calling thread
+     */
+    ThreadRecord* get_record();
+
+    /**
+     * @name: claim_record()
+     * @brief: reuse the record of an exited thread or create one, called by
+     * ThreadRecords with the registry mutex held
+     * @param domain: pointer to the domain
+     * @return: void*, record owned by the calling thread
+     */
+    static void* claim_record(void* domain);
+
+    /**
+     * @name: release_record()
+     * @brief: collect and release the record of an exiting thread, called by
+     * ThreadRecords with the registry mutex held
+     * @param domain: pointer to the domain
+     * @param record: record owned by the exiting thread
+     */
+    static void release_record(void* domain, void* record);
+
+    /**
+     * @name: try_advance()
+     * @brief: advance the global epoch if all active records observed it
+     * @return: uint64_t, global epoch after the attempt
+     */
+    uint64_t try_advance();
+
+    /**
+     * @name: free_list()
+     * @brief: free all nodes of a limbo list
+     * @param list: limbo list, emptied
+     */
+    void free_list(std::vector<Retired>& list);
+
+    /**
+     * @name: collect()
+     * @brief: advance the epoch if possible and free the safe limbo lists of a record
+     * @param record: record owned by the calling thread
+     */
+    void collect(ThreadRecord* record);
+
+    /**
+     * @name: retire_erased()
+     * @brief: put a node into the limbo list of the current epoch
+     * @param pointer: unlinked node
+     * @param deleter: frees the node
+     */
+    void retire_erased(void* pointer, void (*deleter)(void*));
+
+    friend class Guard;
+
+public:
+
+    /**
+     * @name: EpochDomain()
+     * @brief: Constructor
+     * @param retire_batch: number of retired nodes of a thread which triggers a collection
+     */
+    explicit EpochDomain(std::size_t retire_batch = 64);
+
+    /**
+     * @name: EpochDomain()
+     * @brief: Copy Constructor is deleted, threads refer to their records
+     */
+    EpochDomain(const EpochDomain& epochDomain)=delete;
+
+    /**
+     * @name: ~EpochDomain()
+     * @brief: Destructor, frees all retired nodes, no guard may be active
+     */
+    ~EpochDomain();
+
+    /**
+     * @name: retire()
+     * @brief: free a node once no guard can reach it. The node must already be
+     * unlinked, so only guards entered before can still hold it.
+     * @param node: pointer to the unlinked node, allocated with new
+     */
+    template <typename T>
+    void retire(T* node)
+    {
+        retire_erased(node, [](void* pointer){ delete static_cast<T*>(pointer); });
+    }
+
+    /**
+     * @name: collect()
+     * @brief: try to advance the epoch and free the safe nodes retired by the calling thread
+     */
+    void collect();
+
+    /**
+     * @name: get_epoch()
+     * @brief: return the global epoch
+     * @return: uint64_t, global epoch
+     */
+    uint64_t get_epoch() const;
+
+    /**
+     * @name: get_num_pending()
+     * @brief: return the number of nodes retired by the calling thread and not yet freed
+     * @return: std::size_t, number of pending nodes
+     */
+    std::size_t get_num_pending();
+
+    /**
+     * @name: get_num_freed()
+     * @brief: return the number of freed nodes of all threads
+     * @return: uint64_t, number of freed nodes
+     */
+    uint64_t get_num_freed() const;
+
+    /**
+     * @name: get_global()
+     * @brief: return the domain shared by the library
+     * @return: EpochDomain&, shared domain
+     */
+    static EpochDomain& get_global();
+
+}; // class EpochDomain
+
+#endif // EPOCHDOMAIN_HPP
@@ -0,0 +1,157 @@
+/**
+ * @file    : FlatCombiner.hpp
+ * @brief   : Header file of flat-combining synchronization wrapper
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef FLATCOMBINER_HPP
+#define FLATCOMBINER_HPP
+
+#include <thread>       //< allow multi-threading programming
+#include <atomic>       //< allow atomic variables to protect compiler optimization
+#include <type_traits>  //< for std::invoke_result_t
+#include <utility>      //< for std::forward
+#include "SpinLock.hpp"
+#include "PublicationSlots.hpp"
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: FlatCombiner
+ * @brief: protect a shared object T by flat combining. Threads publish their
+ * operation in a per-thread slot, whichever thread gets the lock executes all
+ * published operations on behalf of the others. The object stays in the cache
+ * of the combiner instead of moving between cores for every operation.
+ */
+template <typename T, typename Lock = SpinLock, std::size_t NumSlots = 64>
+class FlatCombiner
+{
+private:
+    // number of busy-wait iterations before yielding the CPU
+    static const unsigned int spins_before_yield_ = 128;
+
+    alignas(CACHE_LINE_SIZE) T data_;       //< shared object
+    alignas(CACHE_LINE_SIZE) Lock lock_;    //< lock of the combiner
+    PublicationSlots<T, NumSlots> slots_;   //< publication slots
+    unsigned long passes_;                  //< number of combining passes, owner only
+    unsigned long combined_;                //< operations executed by passes, owner only
+
+    /**
+     * @name: combine()
+     * @brief: execute all published operations, called by the lock owner
+     */
+    void combine()
+    {
+        passes_++;
+        slots_.for_each_request([this](Request<T>& request){
+            request.run(data_);
+            combined_++;
+        });
+    }
+
+    /**
+     * @name: execute()
+     * @brief: publish a request and wait until it is executed
+     * @param request: request of the calling thread
+     */
+    void execute(Request<T>& request)
+    {
+        // fast path: free lock, execute directly and serve pending requests
+        if(lock_.try_acquire()){
+            request.run(data_);
+            combine();
+            lock_.release();
+            return;
+        }
+
+        typename PublicationSlots<T, NumSlots>::Slot& slot = slots_.get_slot();
+        if(!slots_.try_publish(slot, request)){
+            // slot shared with another thread, execute under the lock directly
+            lock_.acquire();
+            request.run(data_);
+            combine();
+            lock_.release();
+            return;
+        }
+        unsigned int spins = 0;
+        while(slots_.is_pending(slot, request)){
+            if(lock_.try_acquire()){
+                // become the combiner, the own request is part of the pass
+                combine();
+                lock_.release();
+            }else if(++spins < spins_before_yield_){
+                cpu_relax();
+            }else{
+                // reduce CPU contention
+                std::this_thread::yield();
+                spins = 0;
+            }
+        }
+    }
+
+public:
+
+    /**
+     * @name: FlatCombiner()
+     * @brief: Constructor
+     * @param args: constructor arguments of the shared object
+     */
+    template <typename... Args>
+    explicit FlatCombiner(Args&&... args) : data_(std::forward<Args>(args)...)
+    {
+        passes_ = 0;
+        combined_ = 0;
+    }
+
+    /**
+     * @name: FlatCombiner()
+     * @brief: Copy Constructor is deleted, waiters refer to the slots
+     */
+    FlatCombiner(const FlatCombiner& flatCombiner)=delete;
+
+    /**
+     * @name: FlatCombiner()
+     * @brief: Default Destructor
+     */
+    ~FlatCombiner()=default;
+
+    /**
+     * @name: apply()
+     * @brief: apply an operation to the shared object, the operation might be
+     * executed by another thread, but apply() only returns when it is done
+     * @param operation: callable with signature R(T&)
+     * @return: R, result of the operation
+     */
+    template <typename Operation>
+    std::invoke_result_t<Operation&, T&> apply(Operation&& operation)
+    {
+        return apply_request<T>(operation, [this](Request<T>& request){ execute(request); });
+    }
+
+    /**
+     * @name: get_passes()
+     * @brief: return the number of combining passes, exact once threads finished
+     * @return: unsigned long, number of combining passes
+     */
+    unsigned long get_passes() const { return passes_; }
+
+    /**
+     * @name: get_combined()
+     * @brief: return the number of operations executed in combining passes
+     * @return: unsigned long, number of combined operations
+     */
+    unsigned long get_combined() const { return combined_; }
+
+    /**
+     * @name: get_unsafe()
+     * @brief: return the shared object without synchronization, only valid
+     * while no thread applies operations
+     * @return: T&, shared object
+     */
+    T& get_unsafe() { return data_; }
+
+}; // class FlatCombiner
+
+#endif // FLATCOMBINER_HPP
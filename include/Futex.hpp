@@ -0,0 +1,87 @@
+/**
+ * @file    : Futex.hpp
+ * @brief   : Header file of futex wait and wake on 32 bit atomic words
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef FUTEX_HPP
+#define FUTEX_HPP
+
+#include <thread>   //< allow multi-threading programming
+#include <atomic>   //< allow atomic variables to protect compiler optimization
+#include <cstdint>  //< for uint32_t and int64_t
+
+#ifdef __linux__
+#include <linux/futex.h>    //< for FUTEX_WAIT_PRIVATE and FUTEX_WAKE_PRIVATE
+#include <sys/syscall.h>    //< for SYS_futex
+#include <unistd.h>         //< for syscall
+#include <time.h>           //< for struct timespec
+#endif
+
+static_assert(sizeof(std::atomic<uint32_t>) == sizeof(uint32_t),
+              "futex requires std::atomic<uint32_t> to be a plain 32 bit word");
+
+/**
+ * @name: futex_wait()
+ * @brief: put the calling thread to sleep while the word equals expected.
+ * Returns after a wake-up, a signal or immediately if the word differs,
+ * the caller must re-check its condition.
+ * @param word: pointer to the 32 bit atomic word
+ * @param expected: value of the word the thread sleeps on
+ */
+inline void futex_wait(std::atomic<uint32_t>* word, uint32_t expected)
+{
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT_PRIVATE,
+            expected, nullptr, nullptr, 0);
+#else
+    if(word->load(std::memory_order_relaxed) == expected){
+        std::this_thread::yield();
+    }
+#endif
+}
+
+/**
+ * @name: futex_wait_for()
+ * @brief: like futex_wait() but sleeps at most the given time
+ * @param word: pointer to the 32 bit atomic word
+ * @param expected: value of the word the thread sleeps on
+ * @param timeout_in_ns: maximal sleeping time in ns
+ */
+inline void futex_wait_for(std::atomic<uint32_t>* word, uint32_t expected, int64_t timeout_in_ns)
+{
+#ifdef __linux__
+    struct timespec timeout;
+    timeout.tv_sec = timeout_in_ns / 1000000000;
+    timeout.tv_nsec = timeout_in_ns % 1000000000;
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAIT_PRIVATE,
+            expected, &timeout, nullptr, 0);
+#else
+    (void)timeout_in_ns;
+    if(word->load(std::memory_order_relaxed) == expected){
+        std::this_thread::yield();
+    }
+#endif
+}
+
+/**
+ * @name: futex_wake()
+ * @brief: wake up threads sleeping on the word
+ * @param word: pointer to the 32 bit atomic word
+ * @param count: maximal number of threads to wake up
+ */
+inline void futex_wake(std::atomic<uint32_t>* word, int count)
+{
+#ifdef __linux__
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(word), FUTEX_WAKE_PRIVATE,
+            count, nullptr, nullptr, 0);
+#else
+    (void)word;
+    (void)count;
+#endif
+}
+
+#endif // FUTEX_HPP
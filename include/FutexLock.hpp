@@ -0,0 +1,162 @@
+/**
+ * @file    : FutexLock.hpp
+ * @brief   : Header file of spin-then-park Lock based on futex
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef FUTEXLOCK_HPP
+#define FUTEXLOCK_HPP
+
+#include <thread>   //< allow multi-threading programming
+#include <atomic>   //< allow atomic variables to protect compiler optimization
+#include <cstdint>  //< for uint32_t and uint64_t
+#include <chrono>   //< for timed acquisition
+#include "Timer.hpp"
+#include "Futex.hpp"
+#include "Lockable.hpp"
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: FutexLock
+ * @brief: hybrid lock, waiters spin for a bounded time and then park on a futex.
+ * The spin budget follows the sampled hold times: short critical sections are
+ * waited out by spinning, long ones park the waiter immediately.
+ */
+class FutexLock
+{
+private:
+    // lock states of the futex word
+    static const uint32_t unlocked_ = 0;
+    static const uint32_t locked_ = 1;
+    static const uint32_t contended_ = 2;   //< locked and waiters might sleep
+    // every 2^sample_shift_-th hold time is measured
+    static const unsigned int sample_shift_ = 4;
+    // spin budget used if hold times exceed the maximal spin budget
+    static const uint64_t min_spin_in_ns_ = 500;
+
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> state_;  //< futex word
+    std::atomic<uint64_t> avg_hold_in_ns_;  //< moving average of sampled hold times
+    uint64_t max_spin_in_ns_;               //< upper bound of the spin budget
+    uint64_t acquisitions_;                 //< number of acquisitions, owner only
+    high_res_clock::time_point hold_start_; //< start of a sampled hold, owner only
+
+    /**
+     * @name: start_hold()
+     * @brief: start the hold time measurement for sampled acquisitions
+     */
+    void start_hold();
+
+public:
+
+    /**
+     * @name: FutexLock()
+     * @brief: Default Constructor
+     * @param max_spin_in_ns: upper bound of the adaptive spin budget,
+     * spinning is disabled on single CPU machines
+     */
+    explicit FutexLock(uint64_t max_spin_in_ns = 20000);
+
+    /**
+     * @name: FutexLock()
+     * @brief: Copy Constructor is deleted, sleeping waiters refer to the futex word
+     */
+    FutexLock(const FutexLock& futexLock)=delete;
+
+    /**
+     * @name: FutexLock()
+     * @brief: Default Destructor
+     */
+    ~FutexLock()=default;
+
+    /**
+     * @name: acquire()
+     * @brief: lock the futex lock before entering critical region
+     */
+    void acquire();
+
+    /**
+     * @name: release()
+     * @brief: unlock the futex lock before leaving critical region
+     */
+    void release();
+
+    /**
+     * @name: try_acquire()
+     * @brief: try to lock the futex lock once without waiting
+     * @return: boolean, true if the lock was acquired
+     */
+    bool try_acquire();
+
+    /**
+     * @name: lock()
+     * @brief: Lockable interface, same as acquire()
+     */
+    void lock();
+
+    /**
+     * @name: unlock()
+     * @brief: Lockable interface, same as release()
+     */
+    void unlock();
+
+    /**
+     * @name: try_lock()
+     * @brief: Lockable interface, same as try_acquire()
+     * @return: boolean, true if the lock was acquired
+     */
+    bool try_lock();
+
+    /**
+     * @name: try_lock_for()
+     * @brief: spin for the adaptive budget, then park for at most the given duration
+     * @param duration: maximal waiting time
+     * @return: boolean, true if the lock was acquired
+     */
+    template <typename Rep, typename Period>
+    bool try_lock_for(const std::chrono::duration<Rep, Period>& duration)
+    {
+        return try_lock_until(std::chrono::steady_clock::now() + duration);
+    }
+
+    /**
+     * @name: try_lock_until()
+     * @brief: spin for the adaptive budget, then park until the deadline passed
+     * @param deadline: time point after which the attempt is abandoned
+     * @return: boolean, true if the lock was acquired
+     */
+    template <typename Clock, typename Duration>
+    bool try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline)
+    {
+        // spin for the adaptive budget but not beyond the deadline
+        const auto spin_deadline = Clock::now() + std::chrono::nanoseconds(get_spin_budget_in_ns());
+        const bool acquired = (spin_deadline < deadline) ? spin_try_acquire_until(*this, spin_deadline)
+                                                         : spin_try_acquire_until(*this, deadline);
+        if(acquired){
+            return true;
+        }
+        // park with timeout until the lock is free or the deadline passed
+        while(state_.exchange(contended_, std::memory_order_acquire) != unlocked_){
+            const auto remaining = deadline - Clock::now();
+            if(remaining <= remaining.zero()){
+                return false;
+            }
+            futex_wait_for(&state_, contended_,
+                           std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count());
+        }
+        start_hold();
+        return true;
+    }
+
+    /**
+     * @name: get_spin_budget_in_ns()
+     * @brief: return the current spin budget of a waiter before parking
+     * @return: uint64_t, spin budget in ns
+     */
+    uint64_t get_spin_budget_in_ns() const;
+
+}; // class FutexLock
+
+#endif // FUTEXLOCK_HPP
@@ -0,0 +1,248 @@
+/**
+ * @file    : HazardPointers.hpp
+ * @brief   : Header file of hazard pointer memory reclamation for lock-free
+ * data structures
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef HAZARDPOINTERS_HPP
+#define HAZARDPOINTERS_HPP
+
+#include <atomic>   //< allow atomic variables to protect compiler optimization
+#include <cstddef>  //< for std::size_t
+#include <cstdint>  //< for uint64_t
+#include <vector>   //< for the retire lists
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: HazardDomain
+ * @brief: hazard pointers of Michael. A reader publishes the node it is about
+ * to dereference in one of its slots and validates that the node is still
+ * reachable. Retired nodes are kept in a list of the retiring thread, once the
+ * list reaches its threshold all slots are scanned and the unprotected nodes
+ * are freed. The threshold is at least twice the number of slots, so a scan
+ * frees at least half of the list and costs O(1) per retired node. In contrast
+ * to EpochDomain a stalled reader protects only the nodes in its slots, the
+ * memory stays bounded by threads * (threshold + slots) nodes.
+ * Thread records are created on first use and reused after the thread exits,
+ * their remaining nodes are inherited by the next owner.
+ */
+class HazardDomain
+{
+public:
+    // hazard slots per thread, i.e. nodes a thread can protect at once
+    static const unsigned int max_slots = 4;
+
+private:
+    /**
+     * @brief: retired node with its type-erased deleter
+     */
+    struct Retired{
+        void* pointer;              //< unlinked node
+        void (*deleter)(void*);     //< frees the node
+    };
+
+public:
+    /**
+     * @brief: per-thread state, linked into the list of the domain and never freed before it
+     */
+    struct alignas(CACHE_LINE_SIZE) ThreadRecord{
+        std::atomic<void*> slots[max_slots];    //< protected nodes, written by the owner only
+        std::atomic<bool> in_use;               //< owned by a living thread
+        ThreadRecord* next;                     //< next record, immutable once published
+        unsigned int used_slots;                //< bit mask of the slots held by a Hazard, owner only
+        std::vector<Retired> retired;           //< retired nodes, owner only
+    };
+
+    /**
+     * @name: Hazard
+     * @brief: RAII hazard pointer, owns one slot of the calling thread until destroyed.
+     * A thread can hold at most max_slots hazards at once.
+     */
+    class Hazard
+    {
+    private:
+        std::atomic<void*>* slot_;  //< owned slot
+        ThreadRecord* record_;      //< record of the calling thread
+        unsigned int index_;        //< index of the slot
+
+    public:
+        /**
+         * @name: Hazard()
+         * @brief: Constructor, take a free slot of the calling thread
+         * @param domain: domain of the protected nodes, the global domain by default
+         */
+        explicit Hazard(HazardDomain& domain = HazardDomain::get_global());
+
+        /**
+         * @name: Hazard()
+         * @brief: Copy Constructor is deleted, a slot belongs to its thread
+         */
+        Hazard(const Hazard& hazard)=delete;
+
+        /**
+         * @name: ~Hazard()
+         * @brief: Destructor, clear and give back the slot
+         */
+        ~Hazard();
+
+        /**
+         * @name: protect()
+         * @brief: load a pointer and protect the node until reset(), the node
+         * cannot be freed while the source still pointed to it after publishing
+         * @param source: atomic pointer to a node
+         * @return: T*, protected node or nullptr
+         */
+        template <typename T>
+        T* protect(const std::atomic<T*>& source)
+        {
+            T* pointer = source.load(std::memory_order_relaxed);
+            while(true){
+                // release orders the reads of a previously protected node before
+                // the slot changes, a scan seeing the new value may free that node
+                slot_->store(pointer, std::memory_order_release);
+                // publish the slot before validating, pairs with the fence of scan()
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                T* current = source.load(std::memory_order_acquire);
+                if(current == pointer){
+                    return pointer;
+                }
+                pointer = current;
+            }
+        }
+
+        /**
+         * @name: reset()
+         * @brief: stop protecting the node
+         */
+        void reset()
+        {
+            slot_->store(nullptr, std::memory_order_release);
+        }
+
+    }; // class Hazard
+
+private:
+    uint64_t id_;                                                   //< unique id, tells domains at reused addresses apart
+    std::size_t retire_threshold_;                                  //< minimal length of a retire list before a scan
+    alignas(CACHE_LINE_SIZE) std::atomic<ThreadRecord*> records_;  //< list of thread records
+    std::atomic<std::size_t> num_records_;                          //< number of thread records
+    std::atomic<uint64_t> num_retired_;                             //< number of retired nodes
+    std::atomic<uint64_t> num_freed_;                               //< number of freed nodes
+
+    /**
+     * @name: get_record()
+     * @brief: return the record of the calling thread, claim or create it on first use
+     * @return: ThreadRecord*, record owned by the calling thread
+     */
+    ThreadRecord* get_record();
+
+    /**
+     * @name: claim_record()
+     * @brief: reuse the record of an exited thread or create one, called by
+     * ThreadRecords with the registry mutex held
+     * @param domain: pointer to the domain
+     * @return: void*, record owned by the calling thread
+     */
+    static void* claim_record(void* domain);
+
+    /**
+     * @name: release_record()
+     * @brief: scan and release the record of an exiting thread, called by
+     * ThreadRecords with the registry mutex held
+     * @param domain: pointer to the domain
+     * @param record: record owned by the exiting thread
+     */
+    static void release_record(void* domain, void* record);
+
+    /**
+     * @name: scan()
+     * @brief: free the nodes of a retire list which are in no slot
+     * @param record: record owned by the calling thread
+     */
+    void scan(ThreadRecord* record);
+
+    /**
+     * @name: retire_erased()
+     * @brief: put a node into the retire list of the calling thread
+     * @param pointer: unlinked node
+     * @param deleter: frees the node
+     */
+    void retire_erased(void* pointer, void (*deleter)(void*));
+
+    friend class Hazard;
+
+public:
+
+    /**
+     * @name: HazardDomain()
+     * @brief: Constructor
+     * @param retire_threshold: length of a retire list which triggers a scan,
+     * raised to twice the number of slots of all threads
+     */
+    explicit HazardDomain(std::size_t retire_threshold = 64);
+
+    /**
+     * @name: HazardDomain()
+     * @brief: Copy Constructor is deleted, threads refer to their records
+     */
+    HazardDomain(const HazardDomain& hazardDomain)=delete;
+
+    /**
+     * @name: ~HazardDomain()
+     * @brief: Destructor, frees all retired nodes, no hazard may be alive
+     */
+    ~HazardDomain();
+
+    /**
+     * @name: retire()
+     * @brief: free a node once no hazard protects it. The node must already be
+     * unlinked, so no hazard can be validated on it anymore.
+     * @param node: pointer to the unlinked node, allocated with new
+     */
+    template <typename T>
+    void retire(T* node)
+    {
+        retire_erased(node, [](void* pointer){ delete static_cast<T*>(pointer); });
+    }
+
+    /**
+     * @name: scan()
+     * @brief: free the unprotected nodes retired by the calling thread
+     */
+    void scan();
+
+    /**
+     * @name: get_retire_threshold()
+     * @brief: return the length of a retire list which triggers a scan
+     * @return: std::size_t, current threshold
+     */
+    std::size_t get_retire_threshold() const;
+
+    /**
+     * @name: get_num_pending()
+     * @brief: return the number of retired nodes of all threads not yet freed
+     * @return: uint64_t, number of pending nodes
+     */
+    uint64_t get_num_pending() const;
+
+    /**
+     * @name: get_num_freed()
+     * @brief: return the number of freed nodes of all threads
+     * @return: uint64_t, number of freed nodes
+     */
+    uint64_t get_num_freed() const;
+
+    /**
+     * @name: get_global()
+     * @brief: return the domain shared by the library
+     * @return: HazardDomain&, shared domain
+     */
+    static HazardDomain& get_global();
+
+}; // class HazardDomain
+
+#endif // HAZARDPOINTERS_HPP
@@ -0,0 +1,163 @@
+/**
+ * @file    : HazardQueue.hpp
+ * @brief   : Header file of unbounded lock-free Michael-Scott queue with hazard
+ * pointer reclamation
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef HAZARDQUEUE_HPP
+#define HAZARDQUEUE_HPP
+
+#include <atomic>   //< allow atomic variables to protect compiler optimization
+#include <utility>  //< for std::move
+#include "HazardPointers.hpp"
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: HazardQueue
+ * @brief: unbounded multi-producer/multi-consumer queue of Michael and Scott.
+ * The head points to a dummy node, the value of its successor is the front.
+ * A push links its node behind the last node and then swings the tail, threads
+ * finding a lagging tail help to swing it. A pop protects the head and its
+ * successor with two hazards and retires the old dummy. T must be default
+ * constructible for the dummy node.
+ */
+template <typename T>
+class HazardQueue
+{
+private:
+    /**
+     * @brief: list node
+     */
+    struct Node{
+        T value;                    //< stored value, unused in the dummy
+        std::atomic<Node*> next;    //< successor, set once by a push
+    };
+
+    HazardDomain& domain_;                                  //< reclaims popped nodes
+    alignas(CACHE_LINE_SIZE) std::atomic<Node*> head_;     //< dummy node, consumer side
+    alignas(CACHE_LINE_SIZE) std::atomic<Node*> tail_;     //< last or second to last node, producer side
+
+public:
+
+    /**
+     * @name: HazardQueue()
+     * @brief: Constructor
+     * @param domain: domain reclaiming the nodes, the global domain by default
+     */
+    explicit HazardQueue(HazardDomain& domain = HazardDomain::get_global())
+        : domain_(domain)
+    {
+        Node* dummy = new Node;
+        dummy->next.store(nullptr, std::memory_order_relaxed);
+        head_.store(dummy, std::memory_order_relaxed);
+        tail_.store(dummy, std::memory_order_relaxed);
+    }
+
+    /**
+     * @name: HazardQueue()
+     * @brief: Copy Constructor is deleted, nodes may still be referenced by hazards
+     */
+    HazardQueue(const HazardQueue& hazardQueue)=delete;
+
+    /**
+     * @name: ~HazardQueue()
+     * @brief: Destructor, frees the remaining nodes, no operation may be running
+     */
+    ~HazardQueue()
+    {
+        Node* node = head_.load(std::memory_order_relaxed);
+        while(node != nullptr){
+            Node* next = node->next.load(std::memory_order_relaxed);
+            delete node;
+            node = next;
+        }
+    }
+
+    /**
+     * @name: push()
+     * @brief: append a value to the back of the queue
+     * @param value: value to copy into the queue
+     */
+    void push(const T& value)
+    {
+        Node* node = new Node;
+        node->value = value;
+        node->next.store(nullptr, std::memory_order_relaxed);
+        HazardDomain::Hazard hazard(domain_);
+        while(true){
+            Node* tail = hazard.protect(tail_);
+            Node* next = tail->next.load(std::memory_order_acquire);
+            if(next != nullptr){
+                // help a stalled push to swing the tail
+                tail_.compare_exchange_strong(tail, next, std::memory_order_release,
+                                              std::memory_order_relaxed);
+                continue;
+            }
+            if(tail->next.compare_exchange_strong(next, node, std::memory_order_release,
+                                                  std::memory_order_relaxed)){
+                tail_.compare_exchange_strong(tail, node, std::memory_order_release,
+                                              std::memory_order_relaxed);
+                return;
+            }
+        }
+    }
+
+    /**
+     * @name: pop()
+     * @brief: remove the value at the front of the queue
+     * @param value: reference to store the popped value
+     * @return: boolean, false if the queue was empty
+     */
+    bool pop(T& value)
+    {
+        HazardDomain::Hazard head_hazard(domain_);
+        HazardDomain::Hazard next_hazard(domain_);
+        while(true){
+            Node* head = head_hazard.protect(head_);
+            Node* next = next_hazard.protect(head->next);
+            // the successor is only safe if head was still the dummy after protecting it
+            if(head != head_.load(std::memory_order_acquire)){
+                continue;
+            }
+            if(next == nullptr){
+                return false;
+            }
+            Node* tail = tail_.load(std::memory_order_acquire);
+            if(head == tail){
+                // never let the head pass the tail, help the push first
+                tail_.compare_exchange_strong(tail, next, std::memory_order_release,
+                                              std::memory_order_relaxed);
+                continue;
+            }
+            // release passes the node contents on to the poppers of the new dummy
+            if(head_.compare_exchange_strong(head, next, std::memory_order_acq_rel,
+                                             std::memory_order_relaxed)){
+                // next is the new dummy, only this thread reads its value
+                value = std::move(next->value);
+                head_hazard.reset();
+                next_hazard.reset();
+                domain_.retire(head);
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @name: empty()
+     * @brief: return if the queue is empty, a snapshot under concurrency
+     * @return: boolean, true if no value was stored
+     */
+    bool empty() const
+    {
+        HazardDomain::Hazard hazard(domain_);
+        Node* head = hazard.protect(head_);
+        return head->next.load(std::memory_order_acquire) == nullptr;
+    }
+
+}; // class HazardQueue
+
+#endif // HAZARDQUEUE_HPP
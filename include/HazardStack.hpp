@@ -0,0 +1,124 @@
+/**
+ * @file    : HazardStack.hpp
+ * @brief   : Header file of unbounded lock-free Treiber stack with hazard pointer
+ * reclamation
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef HAZARDSTACK_HPP
+#define HAZARDSTACK_HPP
+
+#include <atomic>   //< allow atomic variables to protect compiler optimization
+#include <utility>  //< for std::move
+#include "HazardPointers.hpp"
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: HazardStack
+ * @brief: unbounded lock-free stack (Treiber) allocating a node per push. A pop
+ * protects the top node with a hazard before reading its successor, so the node
+ * cannot be freed and reused in between, which rules out ABA without tags.
+ * Popped nodes are retired to the HazardDomain.
+ */
+template <typename T>
+class HazardStack
+{
+private:
+    /**
+     * @brief: list node, next is immutable once the node is published
+     */
+    struct Node{
+        T value;        //< stored value
+        Node* next;     //< node below
+    };
+
+    HazardDomain& domain_;                                  //< reclaims popped nodes
+    alignas(CACHE_LINE_SIZE) std::atomic<Node*> head_;     //< top of the stack
+
+public:
+
+    /**
+     * @name: HazardStack()
+     * @brief: Constructor
+     * @param domain: domain reclaiming the nodes, the global domain by default
+     */
+    explicit HazardStack(HazardDomain& domain = HazardDomain::get_global())
+        : domain_(domain)
+    {
+        head_.store(nullptr, std::memory_order_relaxed);
+    }
+
+    /**
+     * @name: HazardStack()
+     * @brief: Copy Constructor is deleted, nodes may still be referenced by hazards
+     */
+    HazardStack(const HazardStack& hazardStack)=delete;
+
+    /**
+     * @name: ~HazardStack()
+     * @brief: Destructor, frees the remaining nodes, no operation may be running
+     */
+    ~HazardStack()
+    {
+        Node* node = head_.load(std::memory_order_relaxed);
+        while(node != nullptr){
+            Node* next = node->next;
+            delete node;
+            node = next;
+        }
+    }
+
+    /**
+     * @name: push()
+     * @brief: push a value on top of the stack
+     * @param value: value to copy into the stack
+     */
+    void push(const T& value)
+    {
+        Node* node = new Node{value, head_.load(std::memory_order_relaxed)};
+        // release publishes the node content together with the head
+        while(!head_.compare_exchange_weak(node->next, node, std::memory_order_release,
+                                           std::memory_order_relaxed)){
+        }
+    }
+
+    /**
+     * @name: pop()
+     * @brief: pop the value on top of the stack
+     * @param value: reference to store the popped value
+     * @return: boolean, false if the stack was empty
+     */
+    bool pop(T& value)
+    {
+        HazardDomain::Hazard hazard(domain_);
+        while(true){
+            Node* node = hazard.protect(head_);
+            if(node == nullptr){
+                return false;
+            }
+            if(head_.compare_exchange_strong(node, node->next, std::memory_order_acquire,
+                                             std::memory_order_relaxed)){
+                value = std::move(node->value);
+                hazard.reset();
+                domain_.retire(node);
+                return true;
+            }
+        }
+    }
+
+    /**
+     * @name: empty()
+     * @brief: return if the stack is empty, a snapshot under concurrency
+     * @return: boolean, true if no value was stored
+     */
+    bool empty() const
+    {
+        return head_.load(std::memory_order_acquire) == nullptr;
+    }
+
+}; // class HazardStack
+
+#endif // HAZARDSTACK_HPP
@@ -0,0 +1,402 @@
+/**
+ * @file    : InstrumentedLock.hpp
+ * @brief   : Header file of lock contention profiling wrapper
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef INSTRUMENTEDLOCK_HPP
+#define INSTRUMENTEDLOCK_HPP
+
+#include <thread>       //< allow multi-threading programming
+#include <atomic>       //< allow atomic variables to protect compiler optimization
+#include <chrono>       //< for timed acquisition
+#include <string>
+#include <ostream>
+#include <utility>      //< for std::forward
+#include "Timer.hpp"
+#include "Lockable.hpp"
+
+/**
+ * @name: LockStatistics
+ * @brief: counters and log2 histograms of one lock instance, all counters are
+ * relaxed atomics since readers only need approximate values
+ */
+class LockStatistics
+{
+public:
+    // bucket i counts durations in [2^(i-1), 2^i) ns, bucket 0 counts 0 ns
+    static const unsigned int num_buckets = 40;
+
+private:
+    std::string name_;                                      //< name in the report
+    std::atomic<unsigned long> acquisitions_;               //< successful acquisitions
+    std::atomic<unsigned long> contended_;                  //< acquisitions which had to wait
+    std::atomic<unsigned long> wait_in_ns_;                 //< total waiting time
+    std::atomic<unsigned long> hold_in_ns_;                 //< total holding time
+    std::atomic<unsigned long> wait_histogram_[num_buckets];//< waiting time histogram
+    std::atomic<unsigned long> hold_histogram_[num_buckets];//< holding time histogram
+    bool registered_;                                       //< listed in the report
+
+    /**
+     * @name: get_bucket()
+     * @brief: return the histogram bucket of a duration
+     * @param ns: unsigned long, duration in ns
+     * @return: unsigned int, index of the bucket
+     */
+    static unsigned int get_bucket(unsigned long ns);
+
+    /**
+     * @name: get_percentile()
+     * @brief: return the upper bucket bound of a percentile of a histogram
+     * @param histogram: pointer to the num_buckets counters
+     * @param percentile: double in [0, 1]
+     * @return: unsigned long, upper bound of the bucket in ns
+     */
+    static unsigned long get_percentile(const std::atomic<unsigned long>* histogram, double percentile);
+
+public:
+
+    /**
+     * @name: LockStatistics()
+     * @brief: Constructor, register the statistics for the report
+     * @param name: string, name of the lock in the report
+     */
+    explicit LockStatistics(const std::string& name);
+
+    /**
+     * @name: LockStatistics()
+     * @brief: Constructor
+     * @param name: string, name of the lock in the report
+     * @param registered: boolean, true to list the statistics in the report
+     */
+    LockStatistics(const std::string& name, bool registered);
+
+    /**
+     * @name: LockStatistics()
+     * @brief: Copy Constructor is deleted, the registry refers to the instance
+     */
+    LockStatistics(const LockStatistics& statistics)=delete;
+
+    /**
+     * @name: LockStatistics()
+     * @brief: Destructor, unregister the statistics
+     */
+    ~LockStatistics();
+
+    /**
+     * @name: record_acquire()
+     * @brief: record one acquisition
+     * @param contended: boolean, true if the lock was not free at the first attempt
+     * @param wait_in_ns: unsigned long, waiting time in ns
+     */
+    void record_acquire(bool contended, unsigned long wait_in_ns);
+
+    /**
+     * @name: record_release()
+     * @brief: record one release
+     * @param hold_in_ns: unsigned long, holding time in ns
+     */
+    void record_release(unsigned long hold_in_ns);
+
+    /**
+     * @name: reset()
+     * @brief: clear all counters and histograms
+     */
+    void reset();
+
+    /**
+     * @name: get_name()
+     * @brief: return the name of the lock in the report
+     * @return: const std::string&, name of the lock
+     */
+    const std::string& get_name() const;
+
+    /**
+     * @name: get_acquisitions()
+     * @brief: return the number of acquisitions
+     * @return: unsigned long, number of acquisitions
+     */
+    unsigned long get_acquisitions() const;
+
+    /**
+     * @name: get_contended()
+     * @brief: return the number of acquisitions which had to wait
+     * @return: unsigned long, number of contended acquisitions
+     */
+    unsigned long get_contended() const;
+
+    /**
+     * @name: get_wait_in_ns()
+     * @brief: return the total waiting time
+     * @return: unsigned long, total waiting time in ns
+     */
+    unsigned long get_wait_in_ns() const;
+
+    /**
+     * @name: get_hold_in_ns()
+     * @brief: return the total holding time
+     * @return: unsigned long, total holding time in ns
+     */
+    unsigned long get_hold_in_ns() const;
+
+    /**
+     * @name: get_wait_percentile_in_ns()
+     * @brief: return an upper bound of a waiting time percentile
+     * @param percentile: double in [0, 1]
+     * @return: unsigned long, upper bound of the histogram bucket in ns
+     */
+    unsigned long get_wait_percentile_in_ns(double percentile) const;
+
+    /**
+     * @name: get_hold_percentile_in_ns()
+     * @brief: return an upper bound of a holding time percentile
+     * @param percentile: double in [0, 1]
+     * @return: unsigned long, upper bound of the histogram bucket in ns
+     */
+    unsigned long get_hold_percentile_in_ns(double percentile) const;
+
+    /**
+     * @name: print()
+     * @brief: print counters and histograms of this lock
+     * @param out: output stream
+     */
+    void print(std::ostream& out) const;
+
+    /**
+     * @name: report()
+     * @brief: print all registered locks ranked by total waiting time
+     * @param out: output stream
+     * @param max_locks: maximal number of printed locks
+     */
+    static void report(std::ostream& out, unsigned int max_locks = 20);
+
+    /**
+     * @name: get_disabled()
+     * @brief: return the empty statistics of all locks without profiling,
+     * not listed in the report
+     * @return: const LockStatistics&, statistics without recorded acquisitions
+     */
+    static const LockStatistics& get_disabled();
+
+}; // class LockStatistics
+
+/**
+ * @name: lock_profiling_enabled
+ * @brief: true if the build defines MYLIBRARY_LOCK_PROFILING (cmake option)
+ */
+#ifdef MYLIBRARY_LOCK_PROFILING
+constexpr bool lock_profiling_enabled = true;
+#else
+constexpr bool lock_profiling_enabled = false;
+#endif
+
+/**
+ * @name: InstrumentedLock
+ * @brief: wrapper of any library lock which records acquisitions, contended
+ * acquisitions, waiting and holding times using the Timer clock. The wrapper
+ * does not spin itself, the retries of the wrapped lock are part of the waiting time.
+ * Without lock profiling the wrapper is the plain lock, so production builds pay nothing.
+ */
+template <typename Lock, bool Enabled = lock_profiling_enabled>
+class InstrumentedLock
+{
+private:
+    Lock lock_;                             //< wrapped lock
+    LockStatistics statistics_;             //< recorded statistics
+    high_res_clock::time_point hold_start_; //< start of the current hold, owner only
+
+    /**
+     * @name: elapsed_in_ns()
+     * @brief: return the non-negative time between two time points in ns,
+     * high_res_clock is not guaranteed to be monotonic
+     */
+    static unsigned long elapsed_in_ns(const high_res_clock::time_point& start,
+                                       const high_res_clock::time_point& end)
+    {
+        const long ns = std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count();
+        return (ns > 0) ? ns : 0;
+    }
+
+public:
+
+    /**
+     * @name: InstrumentedLock()
+     * @brief: Constructor
+     * @param name: string, name of the lock in the report
+     * @param args: constructor arguments of the wrapped lock
+     */
+    template <typename... Args>
+    explicit InstrumentedLock(const std::string& name = "lock", Args&&... args)
+        : lock_(std::forward<Args>(args)...), statistics_(name)
+    {
+    }
+
+    /**
+     * @name: InstrumentedLock()
+     * @brief: Copy Constructor is deleted
+     */
+    InstrumentedLock(const InstrumentedLock& instrumentedLock)=delete;
+
+    /**
+     * @name: InstrumentedLock()
+     * @brief: Default Destructor
+     */
+    ~InstrumentedLock()=default;
+
+    /**
+     * @name: acquire()
+     * @brief: lock the wrapped lock and record the waiting time
+     */
+    void acquire()
+    {
+        const high_res_clock::time_point start = high_res_clock::now();
+        if(lock_.try_acquire()){
+            // uncontended, no waiting time
+            hold_start_ = start;
+            statistics_.record_acquire(false, 0);
+            return;
+        }
+        // wait in the lock itself, its spinning, backoff and parking stay unchanged
+        lock_.acquire();
+        hold_start_ = high_res_clock::now();
+        statistics_.record_acquire(true, elapsed_in_ns(start, hold_start_));
+    }
+
+    /**
+     * @name: release()
+     * @brief: record the holding time and unlock the wrapped lock
+     */
+    void release()
+    {
+        statistics_.record_release(elapsed_in_ns(hold_start_, high_res_clock::now()));
+        lock_.release();
+    }
+
+    /**
+     * @name: try_acquire()
+     * @brief: try to lock the wrapped lock once without waiting
+     * @return: boolean, true if the lock was acquired
+     */
+    bool try_acquire()
+    {
+        if(!lock_.try_acquire()){
+            return false;
+        }
+        hold_start_ = high_res_clock::now();
+        statistics_.record_acquire(false, 0);
+        return true;
+    }
+
+    /**
+     * @name: lock()
+     * @brief: Lockable interface, same as acquire()
+     */
+    void lock() { acquire(); }
+
+    /**
+     * @name: unlock()
+     * @brief: Lockable interface, same as release()
+     */
+    void unlock() { release(); }
+
+    /**
+     * @name: try_lock()
+     * @brief: Lockable interface, same as try_acquire()
+     * @return: boolean, true if the lock was acquired
+     */
+    bool try_lock() { return try_acquire(); }
+
+    /**
+     * @name: try_lock_for()
+     * @brief: timed acquisition of the wrapped lock for at most the given duration
+     * @param duration: maximal waiting time
+     * @return: boolean, true if the lock was acquired
+     */
+    template <typename Rep, typename Period>
+    bool try_lock_for(const std::chrono::duration<Rep, Period>& duration)
+    {
+        return try_lock_until(std::chrono::steady_clock::now() + duration);
+    }
+
+    /**
+     * @name: try_lock_until()
+     * @brief: timed acquisition of the wrapped lock until the deadline passed
+     * @param deadline: time point after which the attempt is abandoned
+     * @return: boolean, true if the lock was acquired
+     */
+    template <typename Clock, typename Duration>
+    bool try_lock_until(const std::chrono::time_point<Clock, Duration>& deadline)
+    {
+        const high_res_clock::time_point start = high_res_clock::now();
+        if(lock_.try_acquire()){
+            // uncontended, no waiting time
+            hold_start_ = start;
+            statistics_.record_acquire(false, 0);
+            return true;
+        }
+        if(!lock_.try_lock_until(deadline)){
+            return false;
+        }
+        hold_start_ = high_res_clock::now();
+        statistics_.record_acquire(true, elapsed_in_ns(start, hold_start_));
+        return true;
+    }
+
+    /**
+     * @name: get_statistics()
+     * @brief: return the recorded statistics
+     * @return: const LockStatistics&, statistics of this lock
+     */
+    const LockStatistics& get_statistics() const { return statistics_; }
+
+    /**
+     * @name: get_lock()
+     * @brief: return the wrapped lock
+     * @return: Lock&, wrapped lock
+     */
+    Lock& get_lock() { return lock_; }
+
+}; // class InstrumentedLock
+
+/**
+ * @name: InstrumentedLock
+ * @brief: disabled profiling, the plain lock with the same constructor
+ */
+template <typename Lock>
+class InstrumentedLock<Lock, false> : public Lock
+{
+public:
+
+    /**
+     * @name: InstrumentedLock()
+     * @brief: Constructor, the name is ignored
+     * @param name: string, name of the lock in the report
+     * @param args: constructor arguments of the wrapped lock
+     */
+    template <typename... Args>
+    explicit InstrumentedLock(const std::string& name = "lock", Args&&... args)
+        : Lock(std::forward<Args>(args)...)
+    {
+        (void)name;
+    }
+
+    /**
+     * @name: get_statistics()
+     * @brief: return empty statistics, so call sites compile without profiling
+     * @return: const LockStatistics&, statistics without recorded acquisitions
+     */
+    const LockStatistics& get_statistics() const { return LockStatistics::get_disabled(); }
+
+    /**
+     * @name: get_lock()
+     * @brief: return the wrapped lock
+     * @return: Lock&, wrapped lock
+     */
+    Lock& get_lock() { return *this; }
+
+}; // class InstrumentedLock
+
+#endif // INSTRUMENTEDLOCK_HPP
@@ -0,0 +1,197 @@
+/**
+ * @file    : LockFreeStack.hpp
+ * @brief   : Header file of lock-free Treiber stack with ABA-safe tagged indices
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef LOCKFREESTACK_HPP
+#define LOCKFREESTACK_HPP
+
+#include <atomic>     //< allow atomic variables to protect compiler optimization
+#include <cstdint>    //< for uint32_t and uint64_t
+#include <memory>     //< for std::unique_ptr
+#include <utility>    //< for std::move
+#include <stdexcept>  //< for std::invalid_argument
+#include "SpinLock.hpp"
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: LockFreeStack
+ * @brief: bounded lock-free stack (Treiber) with a preallocated node pool, so
+ * push and pop never call the allocator. Nodes are addressed by 32 bit indices,
+ * the head stores the index together with a 32 bit tag which is incremented
+ * on every update. A stalled thread holding an old head therefore fails its
+ * CAS() even if the same node is on top again (ABA). The free nodes of the pool
+ * form a second Treiber stack.
+ */
+template <typename T>
+class LockFreeStack
+{
+private:
+    /**
+     * @brief: pool node, next is atomic since stalled poppers may read it
+     */
+    struct Node{
+        T value;                        //< stored value, owned by one thread at a time
+        std::atomic<uint32_t> next;     //< index of the node below
+    };
+
+    // index marking the end of a list
+    static const uint32_t null_index_ = 0xFFFFFFFFu;
+
+    std::unique_ptr<Node[]> nodes_;             //< node pool
+    uint32_t capacity_;                         //< number of nodes
+    alignas(CACHE_LINE_SIZE) uint64_t head_;    //< tagged top of the stack
+    alignas(CACHE_LINE_SIZE) uint64_t free_;    //< tagged top of the free list
+
+    static uint32_t get_index(uint64_t tagged) { return uint32_t(tagged); }
+    static uint32_t get_tag(uint64_t tagged) { return uint32_t(tagged >> 32); }
+    static uint64_t make_tagged(uint32_t tag, uint32_t index) { return (uint64_t(tag) << 32) | index; }
+
+    /**
+     * @name: check_capacity()
+     * @brief: reject capacities whose last node index would equal null_index_
+     * @param capacity: uint32_t, requested number of nodes
+     * @return: uint32_t, the accepted capacity
+     */
+    static uint32_t check_capacity(uint32_t capacity)
+    {
+        if(capacity >= null_index_){
+            throw std::invalid_argument("LockFreeStack failed : capacity must be less than 2^32 - 1! \n");
+        }
+        return capacity;
+    }
+
+    /**
+     * @name: push_index()
+     * @brief: push a node onto a tagged list
+     * @param head: pointer to the tagged head of the list
+     * @param index: uint32_t, index of the node owned by the caller
+     */
+    void push_index(uint64_t* head, uint32_t index)
+    {
+        uint64_t old_head = __atomic_load_n(head, __ATOMIC_ACQUIRE);
+        while(true){
+            nodes_[index].next.store(get_index(old_head), std::memory_order_relaxed);
+            // CAS() is a full barrier, the node content is published with the head
+            if(CAS(head, old_head, make_tagged(get_tag(old_head) + 1, index))){
+                return;
+            }
+            old_head = __atomic_load_n(head, __ATOMIC_ACQUIRE);
+        }
+    }
+
+    /**
+     * @name: pop_index()
+     * @brief: pop a node from a tagged list
+     * @param head: pointer to the tagged head of the list
+     * @return: uint32_t, index of the popped node or null_index_ if empty
+     */
+    uint32_t pop_index(uint64_t* head)
+    {
+        uint64_t old_head = __atomic_load_n(head, __ATOMIC_ACQUIRE);
+        while(true){
+            const uint32_t index = get_index(old_head);
+            if(index == null_index_){
+                return null_index_;
+            }
+            // next might be stale if the node was popped meanwhile, the tag detects it
+            const uint32_t next = nodes_[index].next.load(std::memory_order_relaxed);
+            if(CAS(head, old_head, make_tagged(get_tag(old_head) + 1, next))){
+                return index;
+            }
+            old_head = __atomic_load_n(head, __ATOMIC_ACQUIRE);
+        }
+    }
+
+public:
+
+    /**
+     * @name: LockFreeStack()
+     * @brief: Constructor, allocate the node pool once
+     * @param capacity: maximal number of stored values, less than 2^32 - 1,
+     * throws std::invalid_argument otherwise
+     */
+    explicit LockFreeStack(uint32_t capacity)
+        : nodes_(new Node[check_capacity(capacity)]), capacity_(capacity)
+    {
+        head_ = make_tagged(0, null_index_);
+        // chain all nodes into the free list
+        for(uint32_t i = 0; i < capacity_; i++){
+            nodes_[i].next.store((i + 1 < capacity_) ? i + 1 : null_index_, std::memory_order_relaxed);
+        }
+        free_ = make_tagged(0, (capacity_ > 0) ? 0 : null_index_);
+    }
+
+    /**
+     * @name: LockFreeStack()
+     * @brief: Copy Constructor is deleted, threads refer to the node pool
+     */
+    LockFreeStack(const LockFreeStack& lockFreeStack)=delete;
+
+    /**
+     * @name: LockFreeStack()
+     * @brief: Default Destructor
+     */
+    ~LockFreeStack()=default;
+
+    /**
+     * @name: push()
+     * @brief: push a value onto the stack
+     * @param value: value to store
+     * @return: boolean, false if the node pool is exhausted
+     */
+    bool push(const T& value)
+    {
+        const uint32_t index = pop_index(&free_);
+        if(index == null_index_){
+            return false;
+        }
+        nodes_[index].value = value;
+        push_index(&head_, index);
+        return true;
+    }
+
+    /**
+     * @name: pop()
+     * @brief: pop the top value of the stack
+     * @param value: output, overwritten only on success
+     * @return: boolean, false if the stack is empty
+     */
+    bool pop(T& value)
+    {
+        const uint32_t index = pop_index(&head_);
+        if(index == null_index_){
+            return false;
+        }
+        value = std::move(nodes_[index].value);
+        push_index(&free_, index);
+        return true;
+    }
+
+    /**
+     * @name: empty()
+     * @brief: return if the stack is empty, only a snapshot under concurrency
+     * @return: boolean, true if the stack is empty
+     */
+    bool empty() const
+    {
+        return get_index(__atomic_load_n(&head_, __ATOMIC_ACQUIRE)) == null_index_;
+    }
+
+    /**
+     * @name: get_capacity()
+     * @brief: return the size of the node pool
+     * @return: uint32_t, maximal number of stored values
+     */
+    uint32_t get_capacity() const
+    {
+        return capacity_;
+    }
+
+}; // class LockFreeStack
+
+#endif // LOCKFREESTACK_HPP
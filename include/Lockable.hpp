@@ -0,0 +1,88 @@
+/**
+ * @file    : Lockable.hpp
+ * @brief   : Header file of lock concepts and bounded timed spinning
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef LOCKABLE_HPP
+#define LOCKABLE_HPP
+
+#include <thread>   //< allow multi-threading programming
+#include <chrono>   //< for std::chrono::time_point
+#include <concepts> //< for std::convertible_to
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: BasicLockable
+ * @brief: lock usable with std::lock_guard and std::condition_variable_any
+ */
+template <typename Lock>
+concept BasicLockable = requires(Lock& lock){
+    lock.lock();
+    lock.unlock();
+};
+
+/**
+ * @name: Lockable
+ * @brief: lock usable with std::scoped_lock, std::unique_lock and std::try_lock
+ */
+template <typename Lock>
+concept Lockable = BasicLockable<Lock> && requires(Lock& lock){
+    { lock.try_lock() } -> std::convertible_to<bool>;
+};
+
+/**
+ * @name: TimedLockable
+ * @brief: lock usable with the timed constructors of std::unique_lock
+ */
+template <typename Lock>
+concept TimedLockable = Lockable<Lock> && requires(Lock& lock,
+                                                   std::chrono::nanoseconds duration,
+                                                   std::chrono::steady_clock::time_point deadline){
+    { lock.try_lock_for(duration) } -> std::convertible_to<bool>;
+    { lock.try_lock_until(deadline) } -> std::convertible_to<bool>;
+};
+
+/**
+ * @name: LibraryLock
+ * @brief: timed lock which additionally offers the acquire/release interface
+ * of the library locks
+ */
+template <typename Lock>
+concept LibraryLock = TimedLockable<Lock> && requires(Lock& lock){
+    lock.acquire();
+    lock.release();
+    { lock.try_acquire() } -> std::convertible_to<bool>;
+};
+
+/**
+ * @name: spin_try_acquire_until()
+ * @brief: bounded spinning on try_acquire() until the lock is taken or the
+ * deadline passed, yields the CPU after a few failed attempts
+ * @param lock: lock offering try_acquire()
+ * @param deadline: time point after which the attempt is abandoned
+ * @return: boolean, true if the lock was acquired
+ */
+template <typename Lock, typename Clock, typename Duration>
+bool spin_try_acquire_until(Lock& lock, const std::chrono::time_point<Clock, Duration>& deadline)
+{
+    unsigned int spins = 0;
+    while(!lock.try_acquire()){
+        if(Clock::now() >= deadline){
+            return false;
+        }
+        if(++spins < 64){
+            cpu_relax();
+        }else{
+            // reduce CPU contention
+            std::this_thread::yield();
+            spins = 0;
+        }
+    }
+    return true;
+}
+
+#endif // LOCKABLE_HPP
@@ -0,0 +1,228 @@
+/**
+ * @file    : MpmcQueue.hpp
+ * @brief   : Header file of bounded lock-free multi-producer/multi-consumer queue
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef MPMCQUEUE_HPP
+#define MPMCQUEUE_HPP
+
+#include <atomic>   //< allow atomic variables to protect compiler optimization
+#include <cstddef>  //< for std::size_t
+#include <cstdint>  //< for intptr_t
+#include <memory>   //< for std::unique_ptr
+#include <thread>   //< for std::this_thread::yield
+#include <utility>  //< for std::move
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: MpmcQueue
+ * @brief: bounded lock-free queue for any number of producers and consumers
+ * (Vyukov). Every slot carries a sequence number telling which lap of the ring
+ * it is ready for: a producer may write slot i when its sequence equals the
+ * enqueue position, a consumer may read it when the sequence equals the
+ * dequeue position + 1. Producers and consumers only contend on their own
+ * position counter with one CAS, never on a lock, and a slow thread blocks only
+ * its own slot.
+ */
+template <typename T>
+class MpmcQueue
+{
+private:
+    /**
+     * @brief: slot, the sequence number publishes the value
+     */
+    struct Slot{
+        std::atomic<std::size_t> sequence;  //< lap the slot is ready for
+        T value;                            //< stored value
+    };
+
+    // pause steps of the backoff before the blocking calls yield the CPU
+    static const unsigned int max_backoff_ = 64;
+
+    std::unique_ptr<Slot[]> slots_;     //< ring of slots
+    std::size_t mask_;                  //< capacity - 1
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> enqueue_pos_;    //< next position of producers
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> dequeue_pos_;    //< next position of consumers
+
+    /**
+     * @name: backoff()
+     * @brief: wait after a failed attempt, pause with exponentially growing
+     * length first and yield the CPU once the length reached max_backoff_
+     * @param length: current number of pauses, updated
+     */
+    static void backoff(unsigned int& length)
+    {
+        if(length < max_backoff_){
+            for(unsigned int i = 0; i < length; i++){
+                cpu_relax();
+            }
+            length *= 2;
+        }else{
+            std::this_thread::yield();
+        }
+    }
+
+public:
+
+    /**
+     * @name: MpmcQueue()
+     * @brief: Constructor, allocate the slots once
+     * @param capacity: minimal number of slots, rounded up to a power of two of at least 2
+     */
+    explicit MpmcQueue(std::size_t capacity)
+    {
+        std::size_t rounded = 2;
+        while(rounded < capacity){
+            rounded <<= 1;
+        }
+        slots_.reset(new Slot[rounded]);
+        mask_ = rounded - 1;
+        for(std::size_t i = 0; i < rounded; i++){
+            slots_[i].sequence.store(i, std::memory_order_relaxed);
+        }
+        enqueue_pos_.store(0, std::memory_order_relaxed);
+        dequeue_pos_.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @name: MpmcQueue()
+     * @brief: Copy Constructor is deleted, threads refer to the slots
+     */
+    MpmcQueue(const MpmcQueue& mpmcQueue)=delete;
+
+    /**
+     * @name: ~MpmcQueue()
+     * @brief: Default Destructor
+     */
+    ~MpmcQueue()=default;
+
+    /**
+     * @name: try_push()
+     * @brief: append a value without waiting
+     * @param value: value to store
+     * @return: boolean, false if the queue is full
+     */
+    bool try_push(const T& value)
+    {
+        std::size_t pos = enqueue_pos_.load(std::memory_order_relaxed);
+        while(true){
+            Slot& slot = slots_[pos & mask_];
+            const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const intptr_t difference = intptr_t(sequence) - intptr_t(pos);
+            if(difference == 0){
+                // the slot is free in this lap, claim the position
+                if(enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)){
+                    slot.value = value;
+                    // release: publish the value to the consumer of this position
+                    slot.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }else if(difference < 0){
+                // the slot still holds the value of the previous lap
+                return false;
+            }else{
+                // another producer claimed the position
+                pos = enqueue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @name: try_pop()
+     * @brief: remove the oldest value without waiting
+     * @param value: output, overwritten only on success
+     * @return: boolean, false if the queue is empty
+     */
+    bool try_pop(T& value)
+    {
+        std::size_t pos = dequeue_pos_.load(std::memory_order_relaxed);
+        while(true){
+            Slot& slot = slots_[pos & mask_];
+            const std::size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            const intptr_t difference = intptr_t(sequence) - intptr_t(pos + 1);
+            if(difference == 0){
+                // the slot is filled in this lap, claim the position
+                if(dequeue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)){
+                    value = std::move(slot.value);
+                    // release: hand the slot to the producer of the next lap
+                    slot.sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            }else if(difference < 0){
+                // the producer of this position has not finished
+                return false;
+            }else{
+                // another consumer claimed the position
+                pos = dequeue_pos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @name: push()
+     * @brief: append a value, wait with backoff while the queue is full
+     * @param value: value to store
+     */
+    void push(const T& value)
+    {
+        unsigned int length = 1;
+        while(!try_push(value)){
+            backoff(length);
+        }
+    }
+
+    /**
+     * @name: pop()
+     * @brief: remove the oldest value, wait with backoff while the queue is empty
+     * @return: T, removed value
+     */
+    T pop()
+    {
+        T value;
+        unsigned int length = 1;
+        while(!try_pop(value)){
+            backoff(length);
+        }
+        return value;
+    }
+
+    /**
+     * @name: size()
+     * @brief: return the number of claimed positions, only a snapshot under
+     * concurrency and may include values which are still being written
+     * @return: std::size_t, approximate number of stored values
+     */
+    std::size_t size() const
+    {
+        const std::size_t dequeue_pos = dequeue_pos_.load(std::memory_order_acquire);
+        const std::size_t enqueue_pos = enqueue_pos_.load(std::memory_order_acquire);
+        return (enqueue_pos > dequeue_pos) ? enqueue_pos - dequeue_pos : 0;
+    }
+
+    /**
+     * @name: empty()
+     * @brief: return if the queue is empty, only a snapshot under concurrency
+     * @return: boolean, true if the queue is empty
+     */
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @name: get_capacity()
+     * @brief: return the number of slots
+     * @return: std::size_t, power of two
+     */
+    std::size_t get_capacity() const
+    {
+        return mask_ + 1;
+    }
+
+}; // class MpmcQueue
+
+#endif // MPMCQUEUE_HPP
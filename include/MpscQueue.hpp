@@ -0,0 +1,165 @@
+/**
+ * @file    : MpscQueue.hpp
+ * @brief   : Header file of lock-free intrusive multi-producer/single-consumer queue
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef MPSCQUEUE_HPP
+#define MPSCQUEUE_HPP
+
+#include <atomic>       //< allow atomic variables to protect compiler optimization
+#include <cstddef>      //< for std::size_t
+#include <limits>       //< for the unlimited drain
+#include <type_traits>  //< for std::is_base_of
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: MpscNode
+ * @brief: link of the intrusive queue, records derive from it
+ */
+struct MpscNode{
+    std::atomic<MpscNode*> next{nullptr};  //< newer node, written by its producer
+};
+
+/**
+ * @name: MpscQueue
+ * @brief: unbounded intrusive queue for any number of producers and a single
+ * consumer (Vyukov). Records derive from MpscNode and are linked in place, the
+ * queue never allocates. A push costs one atomic exchange of head_ and a store
+ * into the previous node, a pop touches only consumer state unless the queue
+ * runs empty. Between the exchange and the store of a push the newer nodes are
+ * not reachable yet, pop() then reports empty although a push has started; the
+ * node and all nodes pushed after it become visible once that push linked it.
+ * The caller owns a record again after it was popped.
+ */
+template <typename T>
+class MpscQueue
+{
+    static_assert(std::is_base_of<MpscNode, T>::value, "MpscQueue<T> requires T to derive from MpscNode");
+
+private:
+    alignas(CACHE_LINE_SIZE) std::atomic<MpscNode*> head_;    //< newest node, exchanged by producers
+    alignas(CACHE_LINE_SIZE) MpscNode* tail_;                 //< oldest node, consumer only
+    MpscNode stub_;                                         //< dummy node keeping the list non-empty
+
+    /**
+     * @name: push_node()
+     * @brief: link a node behind the newest one
+     * @param node: pointer to the node owned by the caller
+     */
+    void push_node(MpscNode* node)
+    {
+        node->next.store(nullptr, std::memory_order_relaxed);
+        // acq_rel: publish the node content and see the previous producer's node
+        MpscNode* prev = head_.exchange(node, std::memory_order_acq_rel);
+        prev->next.store(node, std::memory_order_release);
+    }
+
+public:
+
+    /**
+     * @name: MpscQueue()
+     * @brief: Constructor, empty queue pointing at the stub
+     */
+    MpscQueue()
+    {
+        head_.store(&stub_, std::memory_order_relaxed);
+        tail_ = &stub_;
+    }
+
+    /**
+     * @name: MpscQueue()
+     * @brief: Copy Constructor is deleted, the nodes point at the stub
+     */
+    MpscQueue(const MpscQueue& mpscQueue)=delete;
+
+    /**
+     * @name: ~MpscQueue()
+     * @brief: Default Destructor, remaining records are not touched
+     */
+    ~MpscQueue()=default;
+
+    /**
+     * @name: push()
+     * @brief: append a record, any thread, wait-free
+     * @param record: pointer to a record not linked into any queue
+     */
+    void push(T* record)
+    {
+        push_node(record);
+    }
+
+    /**
+     * @name: pop()
+     * @brief: remove the oldest record, consumer only
+     * @return: T*, oldest record or nullptr if none is reachable
+     */
+    T* pop()
+    {
+        MpscNode* tail = tail_;
+        MpscNode* next = tail->next.load(std::memory_order_acquire);
+        if(tail == &stub_){
+            // skip the stub
+            if(next == nullptr){
+                return nullptr;
+            }
+            tail_ = next;
+            tail = next;
+            next = next->next.load(std::memory_order_acquire);
+        }
+        if(next != nullptr){
+            tail_ = next;
+            return static_cast<T*>(tail);
+        }
+        if(tail != head_.load(std::memory_order_acquire)){
+            // a producer exchanged head_ but has not linked its node yet
+            return nullptr;
+        }
+        // tail is the last node, put the stub behind it so it can be removed
+        push_node(&stub_);
+        next = tail->next.load(std::memory_order_acquire);
+        if(next != nullptr){
+            tail_ = next;
+            return static_cast<T*>(tail);
+        }
+        return nullptr;
+    }
+
+    /**
+     * @name: drain()
+     * @brief: pop reachable records in order and hand each to a function, consumer only
+     * @param consume: function called with T* for each popped record
+     * @param max_count: maximal number of records
+     * @return: std::size_t, number of popped records
+     */
+    template <typename Function>
+    std::size_t drain(Function&& consume, std::size_t max_count = std::numeric_limits<std::size_t>::max())
+    {
+        std::size_t count = 0;
+        while(count < max_count){
+            T* record = pop();
+            if(record == nullptr){
+                break;
+            }
+            consume(record);
+            count++;
+        }
+        return count;
+    }
+
+    /**
+     * @name: empty()
+     * @brief: return if no record is queued, consumer only
+     * @return: boolean, true if the queue is empty
+     */
+    bool empty() const
+    {
+        return tail_ == &stub_ && head_.load(std::memory_order_acquire) == &stub_;
+    }
+
+}; // class MpscQueue
+
+#endif // MPSCQUEUE_HPP
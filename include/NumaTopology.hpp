@@ -0,0 +1,100 @@
+/**
+ * @file    : NumaTopology.hpp
+ * @brief   : Header file of NUMA topology discovery based on sysfs
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef NUMATOPOLOGY_HPP
+#define NUMATOPOLOGY_HPP
+
+#include <string>
+#include <vector>
+
+/**
+ * @name: NumaTopology
+ * @brief: map CPUs to NUMA nodes by reading /sys/devices/system/node, works
+ * without libnuma and falls back to a single node if sysfs is not available
+ */
+class NumaTopology
+{
+private:
+    std::vector<int> node_of_cpu_;  //< dense node index of every CPU, -1 if unknown
+    unsigned int num_nodes_;        //< number of NUMA nodes
+
+public:
+
+    /**
+     * @name: NumaTopology()
+     * @brief: Default Constructor, read the topology of this machine
+     */
+    NumaTopology();
+
+    /**
+     * @name: NumaTopology()
+     * @brief: Constructor reading the topology from a sysfs-like directory
+     * @param sysfs_path: directory with node<N>/cpulist entries
+     */
+    explicit NumaTopology(const std::string& sysfs_path);
+
+    /**
+     * @name: NumaTopology()
+     * @brief: Copy Constructor
+     */
+    NumaTopology(const NumaTopology& topology)=default;
+
+    /**
+     * @name: NumaTopology()
+     * @brief: Default Destructor
+     */
+    ~NumaTopology()=default;
+
+    /**
+     * @name: get_num_nodes()
+     * @brief: return the number of NUMA nodes, at least one
+     * @return: unsigned int, number of NUMA nodes
+     */
+    unsigned int get_num_nodes() const;
+
+    /**
+     * @name: get_num_cpus()
+     * @brief: return the number of CPUs known to the topology
+     * @return: unsigned int, number of CPUs
+     */
+    unsigned int get_num_cpus() const;
+
+    /**
+     * @name: get_node_of_cpu()
+     * @brief: return the node index of a CPU, unknown CPUs belong to node 0
+     * @param cpu: unsigned int, CPU number as reported by the kernel
+     * @return: unsigned int, dense node index in [0, get_num_nodes())
+     */
+    unsigned int get_node_of_cpu(unsigned int cpu) const;
+
+    /**
+     * @name: get_current_node()
+     * @brief: return the node index of the CPU running the calling thread
+     * @return: unsigned int, dense node index in [0, get_num_nodes())
+     */
+    unsigned int get_current_node() const;
+
+    /**
+     * @name: get_cpus_of_node()
+     * @brief: return all CPUs of a node
+     * @param node: unsigned int, dense node index
+     * @return: std::vector<unsigned int>, CPU numbers of the node
+     */
+    std::vector<unsigned int> get_cpus_of_node(unsigned int node) const;
+
+    /**
+     * @name: get_system()
+     * @brief: return the topology of this machine, read once
+     * @return: const NumaTopology&, shared topology
+     */
+    static const NumaTopology& get_system();
+
+}; // class NumaTopology
+
+#endif // NUMATOPOLOGY_HPP
@@ -0,0 +1,429 @@
+/**
+ * @file    : ParallelAlgorithms.hpp
+ * @brief   : Header file of parallel STL-style algorithms on the ThreadPool:
+ * fill, iota, transform_reduce, inclusive/exclusive scan, copy_if and partition
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef PARALLELALGORITHMS_HPP
+#define PARALLELALGORITHMS_HPP
+
+#include <cstddef>      //< for std::size_t
+#include <algorithm>    //< for std::fill, std::copy_if and std::move
+#include <functional>   //< for std::plus and std::multiplies
+#include <iterator>     //< for std::iterator_traits
+#include <utility>      //< for std::pair
+#include <vector>       //< for the block results
+#include "ParallelFor.hpp"
+
+// All algorithms split the input into one contiguous block per thread, see
+// get_static_block(), and run plain loops over their block which the compiler
+// can vectorize. The iterators must be random access, the operations must be
+// associative and the predicates free of side effects, since they run on
+// several threads and may be evaluated twice.
+
+// minimal number of elements per block, smaller inputs use fewer threads
+inline constexpr std::size_t algorithm_grain_size = 4096;
+
+/**
+ * @name: get_num_blocks()
+ * @brief: return the number of blocks of an algorithm
+ * @param num_elements: number of elements
+ * @param pool: executing pool
+ * @return: std::size_t, at most one block per worker and algorithm_grain_size elements
+ */
+inline std::size_t get_num_blocks(std::size_t num_elements, const ThreadPool& pool)
+{
+    return get_num_participants((num_elements + algorithm_grain_size - 1) / algorithm_grain_size, pool);
+}
+
+/**
+ * @name: parallel_fill()
+ * @brief: assign value to all elements of [first, last)
+ * @param first: first element
+ * @param last: behind the last element
+ * @param value: assigned value
+ * @param pool: executing pool, the global pool by default
+ */
+template <typename RandomIt, typename T>
+void parallel_fill(RandomIt first, RandomIt last, const T& value, ThreadPool& pool = ThreadPool::get_global())
+{
+    const std::size_t n = std::size_t(last - first);
+    const std::size_t num_blocks = get_num_blocks(n, pool);
+    run_participants(pool, num_blocks, [&](std::size_t block){
+        const auto [begin, end] = get_static_block(n, num_blocks, block);
+        std::fill(first + begin, first + end, value);
+    });
+}
+
+/**
+ * @name: parallel_iota()
+ * @brief: assign value, value + 1, ... to the elements of [first, last)
+ * @param first: first element
+ * @param last: behind the last element
+ * @param value: value of the first element
+ * @param pool: executing pool, the global pool by default
+ */
+template <typename RandomIt, typename T>
+void parallel_iota(RandomIt first, RandomIt last, T value, ThreadPool& pool = ThreadPool::get_global())
+{
+    const std::size_t n = std::size_t(last - first);
+    const std::size_t num_blocks = get_num_blocks(n, pool);
+    run_participants(pool, num_blocks, [&](std::size_t block){
+        const auto [begin, end] = get_static_block(n, num_blocks, block);
+        for(std::size_t i = begin; i < end; i++){
+            first[i] = value + T(i);
+        }
+    });
+}
+
+/**
+ * @name: parallel_transform_reduce()
+ * @brief: reduce transform(x) over all elements x of [first, last) and init
+ * @param first: first element
+ * @param last: behind the last element
+ * @param init: initial value
+ * @param reduce: associative callable with (T, T) returning T
+ * @param transform: callable with an element returning T
+ * @param pool: executing pool, the global pool by default
+ * @return: T, reduced value
+ */
+template <typename RandomIt, typename T, typename Reduce, typename Transform>
+T parallel_transform_reduce(RandomIt first, RandomIt last, T init, Reduce reduce, Transform transform,
+                            ThreadPool& pool = ThreadPool::get_global())
+{
+    const std::size_t n = std::size_t(last - first);
+    if(n == 0){
+        return init;
+    }
+    const std::size_t num_blocks = get_num_blocks(n, pool);
+    std::vector<T> partials(num_blocks);
+    run_participants(pool, num_blocks, [&](std::size_t block){
+        const auto [begin, end] = get_static_block(n, num_blocks, block);
+        T partial = transform(first[begin]);
+        for(std::size_t i = begin + 1; i < end; i++){
+            partial = reduce(partial, transform(first[i]));
+        }
+        partials[block] = partial;
+    });
+    for(const T& partial : partials){
+        init = reduce(init, partial);
+    }
+    return init;
+}
+
+/**
+ * @name: parallel_transform_reduce()
+ * @brief: reduce transform(x, y) over the pairs of [first1, last1) and the
+ * sequence at first2 and init, the inner product by default
+ * @param first1: first element of the first sequence
+ * @param last1: behind the last element of the first sequence
+ * @param first2: first element of the second sequence
+ * @param init: initial value
+ * @param reduce: associative callable with (T, T) returning T
+ * @param transform: callable with two elements returning T
+ * @param pool: executing pool, the global pool by default
+ * @return: T, reduced value
+ */
+template <typename RandomIt1, typename RandomIt2, typename T,
+          typename Reduce = std::plus<>, typename Transform = std::multiplies<>>
+T parallel_transform_reduce(RandomIt1 first1, RandomIt1 last1, RandomIt2 first2, T init,
+                            Reduce reduce = Reduce(), Transform transform = Transform(),
+                            ThreadPool& pool = ThreadPool::get_global())
+{
+    const std::size_t n = std::size_t(last1 - first1);
+    if(n == 0){
+        return init;
+    }
+    const std::size_t num_blocks = get_num_blocks(n, pool);
+    std::vector<T> partials(num_blocks);
+    run_participants(pool, num_blocks, [&](std::size_t block){
+        const auto [begin, end] = get_static_block(n, num_blocks, block);
+        T partial = transform(first1[begin], first2[begin]);
+        for(std::size_t i = begin + 1; i < end; i++){
+            partial = reduce(partial, transform(first1[i], first2[i]));
+        }
+        partials[block] = partial;
+    });
+    for(const T& partial : partials){
+        init = reduce(init, partial);
+    }
+    return init;
+}
+
+/**
+ * @name: parallel_inclusive_scan()
+ * @brief: write the prefix sums x0, x0 + x1, ... of [first, last) to d_first.
+ * Two passes: every block reduces its elements, the block sums are scanned
+ * sequentially into carries, every block scans its elements starting at its
+ * carry. The output may be the input.
+ * @param first: first element
+ * @param last: behind the last element
+ * @param d_first: first element of the output
+ * @param op: associative callable with (T, T) returning T, addition by default
+ * @param pool: executing pool, the global pool by default
+ * @return: OutputIt, behind the last written element
+ */
+template <typename RandomIt, typename OutputIt, typename Operation = std::plus<>>
+OutputIt parallel_inclusive_scan(RandomIt first, RandomIt last, OutputIt d_first, Operation op = Operation(),
+                                 ThreadPool& pool = ThreadPool::get_global())
+{
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    const std::size_t n = std::size_t(last - first);
+    if(n == 0){
+        return d_first;
+    }
+    const std::size_t num_blocks = get_num_blocks(n, pool);
+    std::vector<T> carries(num_blocks);
+    if(num_blocks > 1){
+        std::vector<T> sums(num_blocks);
+        run_participants(pool, num_blocks, [&](std::size_t block){
+            const auto [begin, end] = get_static_block(n, num_blocks, block);
+            T sum = first[begin];
+            for(std::size_t i = begin + 1; i < end; i++){
+                sum = op(sum, first[i]);
+            }
+            sums[block] = sum;
+        });
+        carries[1] = sums[0];
+        for(std::size_t block = 2; block < num_blocks; block++){
+            carries[block] = op(carries[block - 1], sums[block - 1]);
+        }
+    }
+    run_participants(pool, num_blocks, [&](std::size_t block){
+        const auto [begin, end] = get_static_block(n, num_blocks, block);
+        T sum = (block == 0) ? T(first[begin]) : op(carries[block], first[begin]);
+        d_first[begin] = sum;
+        for(std::size_t i = begin + 1; i < end; i++){
+            sum = op(sum, first[i]);
+            d_first[i] = sum;
+        }
+    });
+    return d_first + n;
+}
+
+/**
+ * @name: parallel_exclusive_scan()
+ * @brief: write the prefix sums init, init + x0, ... of [first, last) to
+ * d_first, two passes like parallel_inclusive_scan(). The output may be the input.
+ * @param first: first element
+ * @param last: behind the last element
+ * @param d_first: first element of the output
+ * @param init: first output value
+ * @param op: associative callable with (T, T) returning T, addition by default
+ * @param pool: executing pool, the global pool by default
+ * @return: OutputIt, behind the last written element
+ */
+template <typename RandomIt, typename OutputIt, typename T, typename Operation = std::plus<>>
+OutputIt parallel_exclusive_scan(RandomIt first, RandomIt last, OutputIt d_first, T init,
+                                 Operation op = Operation(), ThreadPool& pool = ThreadPool::get_global())
+{
+    const std::size_t n = std::size_t(last - first);
+    if(n == 0){
+        return d_first;
+    }
+    const std::size_t num_blocks = get_num_blocks(n, pool);
+    std::vector<T> carries(num_blocks);
+    carries[0] = init;
+    if(num_blocks > 1){
+        std::vector<T> sums(num_blocks);
+        // the last block's sum is not needed
+        run_participants(pool, num_blocks - 1, [&](std::size_t block){
+            const auto [begin, end] = get_static_block(n, num_blocks, block);
+            T sum = first[begin];
+            for(std::size_t i = begin + 1; i < end; i++){
+                sum = op(sum, first[i]);
+            }
+            sums[block] = sum;
+        });
+        for(std::size_t block = 1; block < num_blocks; block++){
+            carries[block] = op(carries[block - 1], sums[block - 1]);
+        }
+    }
+    run_participants(pool, num_blocks, [&](std::size_t block){
+        const auto [begin, end] = get_static_block(n, num_blocks, block);
+        T sum = carries[block];
+        for(std::size_t i = begin; i < end; i++){
+            // read before write, the output may alias the input
+            T value = first[i];
+            d_first[i] = sum;
+            sum = op(sum, value);
+        }
+    });
+    return d_first + n;
+}
+
+/**
+ * @name: count_per_block()
+ * @brief: count the elements satisfying pred in every block
+ * @param first: first element
+ * @param n: number of elements
+ * @param num_blocks: number of blocks
+ * @param pred: callable with an element returning a boolean
+ * @param pool: executing pool
+ * @return: std::vector<std::size_t>, count of every block
+ */
+template <typename RandomIt, typename Predicate>
+std::vector<std::size_t> count_per_block(RandomIt first, std::size_t n, std::size_t num_blocks,
+                                         Predicate& pred, ThreadPool& pool)
+{
+    std::vector<std::size_t> counts(num_blocks);
+    run_participants(pool, num_blocks, [&](std::size_t block){
+        const auto [begin, end] = get_static_block(n, num_blocks, block);
+        std::size_t count = 0;
+        for(std::size_t i = begin; i < end; i++){
+            count += pred(first[i]) ? 1 : 0;
+        }
+        counts[block] = count;
+    });
+    return counts;
+}
+
+/**
+ * @name: parallel_copy_if()
+ * @brief: copy the elements satisfying pred to d_first, keeping their order
+ * (stream compaction). Every block counts its matches, the counts are scanned
+ * into output offsets, every block copies its matches to its offset.
+ * @param first: first element
+ * @param last: behind the last element
+ * @param d_first: first element of the output, must not overlap the input
+ * @param pred: callable with an element returning a boolean
+ * @param pool: executing pool, the global pool by default
+ * @return: OutputIt, behind the last copied element
+ */
+template <typename RandomIt, typename OutputIt, typename Predicate>
+OutputIt parallel_copy_if(RandomIt first, RandomIt last, OutputIt d_first, Predicate pred,
+                          ThreadPool& pool = ThreadPool::get_global())
+{
+    const std::size_t n = std::size_t(last - first);
+    const std::size_t num_blocks = get_num_blocks(n, pool);
+    if(num_blocks == 1){
+        // a single pass without counting
+        return std::copy_if(first, last, d_first, pred);
+    }
+    const std::vector<std::size_t> counts = count_per_block(first, n, num_blocks, pred, pool);
+    std::vector<std::size_t> offsets(num_blocks, 0);
+    for(std::size_t block = 1; block < num_blocks; block++){
+        offsets[block] = offsets[block - 1] + counts[block - 1];
+    }
+    run_participants(pool, num_blocks, [&](std::size_t block){
+        const auto [begin, end] = get_static_block(n, num_blocks, block);
+        OutputIt out = d_first + offsets[block];
+        for(std::size_t i = begin; i < end; i++){
+            if(pred(first[i])){
+                *out = first[i];
+                ++out;
+            }
+        }
+    });
+    return d_first + (offsets[num_blocks - 1] + counts[num_blocks - 1]);
+}
+
+/**
+ * @name: write_partition()
+ * @brief: second pass of the partitions, every block copies its matches and
+ * non-matches to the offsets given by the counts of the blocks before it,
+ * moves the elements if Move is true
+ * @param first: first element
+ * @param n: number of elements
+ * @param counts: number of matches of every block, see count_per_block()
+ * @param d_true: output of the matching elements
+ * @param d_false: output of the other elements
+ * @param pred: callable with an element returning a boolean
+ * @param pool: executing pool
+ * @return: std::size_t, number of matching elements
+ */
+template <bool Move, typename RandomIt, typename OutputIt1, typename OutputIt2, typename Predicate>
+std::size_t write_partition(RandomIt first, std::size_t n, const std::vector<std::size_t>& counts,
+                            OutputIt1 d_true, OutputIt2 d_false, Predicate& pred, ThreadPool& pool)
+{
+    const std::size_t num_blocks = counts.size();
+    std::vector<std::size_t> offsets(num_blocks, 0);
+    for(std::size_t block = 1; block < num_blocks; block++){
+        offsets[block] = offsets[block - 1] + counts[block - 1];
+    }
+    run_participants(pool, num_blocks, [&](std::size_t block){
+        const auto [begin, end] = get_static_block(n, num_blocks, block);
+        OutputIt1 out_true = d_true + offsets[block];
+        // elements before the block which did not match
+        OutputIt2 out_false = d_false + (begin - offsets[block]);
+        for(std::size_t i = begin; i < end; i++){
+            if(pred(first[i])){
+                if constexpr(Move){
+                    *out_true = std::move(first[i]);
+                }else{
+                    *out_true = first[i];
+                }
+                ++out_true;
+            }else{
+                if constexpr(Move){
+                    *out_false = std::move(first[i]);
+                }else{
+                    *out_false = first[i];
+                }
+                ++out_false;
+            }
+        }
+    });
+    return offsets[num_blocks - 1] + counts[num_blocks - 1];
+}
+
+/**
+ * @name: parallel_partition_copy()
+ * @brief: copy the elements satisfying pred to d_true and the others to d_false,
+ * both keeping their order
+ * @param first: first element
+ * @param last: behind the last element
+ * @param d_true: output of the matching elements, must not overlap the input
+ * @param d_false: output of the other elements, must not overlap the input
+ * @param pred: callable with an element returning a boolean
+ * @param pool: executing pool, the global pool by default
+ * @return: std::pair<OutputIt1, OutputIt2>, behind the last element of both outputs
+ */
+template <typename RandomIt, typename OutputIt1, typename OutputIt2, typename Predicate>
+std::pair<OutputIt1, OutputIt2> parallel_partition_copy(RandomIt first, RandomIt last, OutputIt1 d_true,
+                                                        OutputIt2 d_false, Predicate pred,
+                                                        ThreadPool& pool = ThreadPool::get_global())
+{
+    const std::size_t n = std::size_t(last - first);
+    const std::size_t num_blocks = get_num_blocks(n, pool);
+    const std::vector<std::size_t> counts = count_per_block(first, n, num_blocks, pred, pool);
+    const std::size_t num_true = write_partition<false>(first, n, counts, d_true, d_false, pred, pool);
+    return {d_true + num_true, d_false + (n - num_true)};
+}
+
+/**
+ * @name: parallel_partition()
+ * @brief: reorder [first, last) so the elements satisfying pred come first,
+ * stable, moves the elements through a temporary buffer of the input size
+ * @param first: first element
+ * @param last: behind the last element
+ * @param pred: callable with an element returning a boolean
+ * @param pool: executing pool, the global pool by default
+ * @return: RandomIt, first element of the second group
+ */
+template <typename RandomIt, typename Predicate>
+RandomIt parallel_partition(RandomIt first, RandomIt last, Predicate pred,
+                            ThreadPool& pool = ThreadPool::get_global())
+{
+    using T = typename std::iterator_traits<RandomIt>::value_type;
+    const std::size_t n = std::size_t(last - first);
+    const std::size_t num_blocks = get_num_blocks(n, pool);
+    const std::vector<std::size_t> counts = count_per_block(first, n, num_blocks, pred, pool);
+    std::size_t num_true = 0;
+    for(std::size_t count : counts){
+        num_true += count;
+    }
+    std::vector<T> buffer(n);
+    write_partition<true>(first, n, counts, buffer.begin(), buffer.begin() + num_true, pred, pool);
+    run_participants(pool, num_blocks, [&](std::size_t block){
+        const auto [begin, end] = get_static_block(n, num_blocks, block);
+        std::move(buffer.begin() + begin, buffer.begin() + end, first + begin);
+    });
+    return first + num_true;
+}
+
+#endif // PARALLELALGORITHMS_HPP
@@ -0,0 +1,294 @@
+/**
+ * @file    : ParallelFor.hpp
+ * @brief   : Header file of parallel_for and parallel_reduce with OpenMP-like
+ * schedules on the ThreadPool
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef PARALLELFOR_HPP
+#define PARALLELFOR_HPP
+
+#include <atomic>       //< for the shared chunk counter
+#include <cstddef>      //< for std::size_t
+#include <algorithm>    //< for std::min and std::max
+#include <vector>       //< for the partial results
+#include <utility>      //< for std::pair
+#include "ThreadPool.hpp"
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: Schedule
+ * @brief: distribution of the iterations onto the threads, like schedule() of OpenMP
+ * - STATIC : contiguous blocks of equal size, or chunks dealt round-robin if chunk > 0
+ * - DYNAMIC : threads grab the next chunk from a shared counter
+ * - GUIDED : like DYNAMIC with chunks of remaining / (2 * threads), at least chunk
+ * - AUTO : DYNAMIC with chunks of an eighth of a static block
+ */
+struct Schedule{
+    enum Kind{ STATIC, DYNAMIC, GUIDED, AUTO };
+    Kind kind;          //< distribution
+    std::size_t chunk;  //< chunk size, or minimal chunk size for GUIDED
+};
+
+/**
+ * @name: schedule_static()
+ * @brief: return a static schedule, the default
+ * @param chunk: 0 for one block per thread, else size of the round-robin chunks
+ * @return: Schedule, static schedule
+ */
+inline Schedule schedule_static(std::size_t chunk = 0)
+{
+    return Schedule{Schedule::STATIC, chunk};
+}
+
+/**
+ * @name: schedule_dynamic()
+ * @brief: return a dynamic schedule, for irregular iterations
+ * @param chunk: number of iterations grabbed at once
+ * @return: Schedule, dynamic schedule
+ */
+inline Schedule schedule_dynamic(std::size_t chunk = 1)
+{
+    return Schedule{Schedule::DYNAMIC, std::max<std::size_t>(1, chunk)};
+}
+
+/**
+ * @name: schedule_guided()
+ * @brief: return a guided schedule, decreasing chunk sizes
+ * @param min_chunk: minimal number of iterations grabbed at once
+ * @return: Schedule, guided schedule
+ */
+inline Schedule schedule_guided(std::size_t min_chunk = 1)
+{
+    return Schedule{Schedule::GUIDED, std::max<std::size_t>(1, min_chunk)};
+}
+
+/**
+ * @name: schedule_auto()
+ * @brief: return the schedule chosen by the library
+ * @return: Schedule, automatic schedule
+ */
+inline Schedule schedule_auto()
+{
+    return Schedule{Schedule::AUTO, 0};
+}
+
+/**
+ * @name: get_num_participants()
+ * @brief: return the number of threads sharing a loop, the caller included
+ * @param num_iterations: number of iterations
+ * @param pool: pool executing the loop
+ * @return: std::size_t, one thread per worker but not more than iterations
+ */
+inline std::size_t get_num_participants(std::size_t num_iterations, const ThreadPool& pool)
+{
+    return std::max<std::size_t>(1, std::min<std::size_t>(pool.get_num_threads(), num_iterations));
+}
+
+/**
+ * @name: get_static_block()
+ * @brief: return the block of a participant when [0, num_iterations) is split into
+ * num_participants balanced contiguous blocks, the first num_iterations % num_participants
+ * blocks are one iteration larger
+ * @param num_iterations: number of iterations
+ * @param num_participants: number of blocks
+ * @param participant: index of the block
+ * @return: std::pair<std::size_t, std::size_t>, begin and end of the block
+ */
+inline std::pair<std::size_t, std::size_t> get_static_block(std::size_t num_iterations, std::size_t num_participants,
+                                                            std::size_t participant)
+{
+    const std::size_t block = num_iterations / num_participants;
+    const std::size_t remainder = num_iterations % num_participants;
+    const std::size_t begin = participant * block + std::min(participant, remainder);
+    return {begin, begin + block + (participant < remainder ? 1 : 0)};
+}
+
+/**
+ * @name: run_participants()
+ * @brief: run a function for every participant, participant 0 on the calling
+ * thread and the others as tasks of the pool, rethrows the first exception
+ * @param pool: pool executing the tasks
+ * @param num_participants: number of participants
+ * @param function: callable with the participant index (std::size_t)
+ */
+template <typename Function>
+void run_participants(ThreadPool& pool, std::size_t num_participants, Function&& function)
+{
+    if(num_participants == 1){
+        function(std::size_t(0));
+        return;
+    }
+    TaskGroup group(pool);
+    for(std::size_t participant = 1; participant < num_participants; participant++){
+        group.run([&function, participant](){ function(participant); });
+    }
+    try{
+        function(std::size_t(0));
+    }catch(...){
+        // the tasks refer to the caller's frame, let them finish first
+        try{
+            group.wait();
+        }catch(...){
+        }
+        throw;
+    }
+    group.wait();
+}
+
+/**
+ * @name: for_each_chunk()
+ * @brief: split [0, num_iterations) into chunks and distribute them by the schedule
+ * @param num_iterations: number of iterations
+ * @param num_participants: number of threads, see get_num_participants()
+ * @param schedule: distribution of the chunks
+ * @param pool: pool executing the chunks
+ * @param body: callable with (begin, end, participant) of a chunk
+ */
+template <typename Body>
+void for_each_chunk(std::size_t num_iterations, std::size_t num_participants, Schedule schedule,
+                    ThreadPool& pool, Body&& body)
+{
+    const std::size_t n = num_iterations;
+    const std::size_t num_threads = num_participants;
+    if(n == 0){
+        return;
+    }
+    if(schedule.kind == Schedule::AUTO){
+        schedule = schedule_dynamic(std::max<std::size_t>(1, n / (8 * num_threads)));
+    }
+    if(schedule.kind == Schedule::STATIC && schedule.chunk == 0){
+        run_participants(pool, num_threads, [&](std::size_t participant){
+            const auto [begin, end] = get_static_block(n, num_threads, participant);
+            if(begin < end){
+                body(begin, end, participant);
+            }
+        });
+    }else if(schedule.kind == Schedule::STATIC){
+        const std::size_t chunk = schedule.chunk;
+        run_participants(pool, num_threads, [&](std::size_t participant){
+            for(std::size_t begin = participant * chunk; begin < n; begin += num_threads * chunk){
+                body(begin, std::min(begin + chunk, n), participant);
+            }
+        });
+    }else{
+        struct alignas(CACHE_LINE_SIZE) Counter{
+            std::atomic<std::size_t> next{0};
+        } counter;
+        const std::size_t chunk = schedule.chunk;
+        if(schedule.kind == Schedule::DYNAMIC){
+            run_participants(pool, num_threads, [&](std::size_t participant){
+                std::size_t begin;
+                while((begin = counter.next.fetch_add(chunk, std::memory_order_relaxed)) < n){
+                    body(begin, std::min(begin + chunk, n), participant);
+                }
+            });
+        }else{
+            run_participants(pool, num_threads, [&](std::size_t participant){
+                std::size_t begin = counter.next.load(std::memory_order_relaxed);
+                while(begin < n){
+                    const std::size_t size = std::max((n - begin) / (2 * num_threads), chunk);
+                    const std::size_t end = std::min(begin + size, n);
+                    if(counter.next.compare_exchange_weak(begin, end, std::memory_order_relaxed)){
+                        body(begin, end, participant);
+                        begin = counter.next.load(std::memory_order_relaxed);
+                    }
+                }
+            });
+        }
+    }
+}
+
+/**
+ * @name: parallel_for_blocks()
+ * @brief: execute body on blocks of [first, last) in parallel, the body loops
+ * over its block itself, which lets the compiler vectorize it
+ * @param first: first index
+ * @param last: index behind the last
+ * @param body: callable with (Index begin, Index end)
+ * @param schedule: distribution of the iterations, static by default
+ * @param pool: executing pool, the global pool by default
+ */
+template <typename Index, typename Body>
+void parallel_for_blocks(Index first, Index last, Body&& body, Schedule schedule = schedule_static(),
+                         ThreadPool& pool = ThreadPool::get_global())
+{
+    if(!(first < last)){
+        return;
+    }
+    const std::size_t n = std::size_t(last - first);
+    for_each_chunk(n, get_num_participants(n, pool), schedule, pool,
+                   [&](std::size_t begin, std::size_t end, std::size_t){
+        body(Index(first + begin), Index(first + end));
+    });
+}
+
+/**
+ * @name: parallel_for()
+ * @brief: execute body(i) for all i in [first, last) in parallel, like
+ * #pragma omp parallel for schedule(...)
+ * @param first: first index
+ * @param last: index behind the last
+ * @param body: callable with (Index i)
+ * @param schedule: distribution of the iterations, static by default
+ * @param pool: executing pool, the global pool by default
+ */
+template <typename Index, typename Body>
+void parallel_for(Index first, Index last, Body&& body, Schedule schedule = schedule_static(),
+                  ThreadPool& pool = ThreadPool::get_global())
+{
+    parallel_for_blocks(first, last, [&body](Index begin, Index end){
+        for(Index i = begin; i < end; i++){
+            body(i);
+        }
+    }, schedule, pool);
+}
+
+/**
+ * @name: parallel_reduce()
+ * @brief: reduce map(i) for all i in [first, last) in parallel, like
+ * #pragma omp parallel for reduction(...). Every thread accumulates into its
+ * own cache line padded partial, the partials are combined in thread order at
+ * the end, no lock or atomic is taken per iteration. With a static schedule the
+ * result is deterministic, reduce must be associative in any case.
+ * @param first: first index
+ * @param last: index behind the last
+ * @param identity: neutral element of reduce
+ * @param map: callable with (Index i) returning T
+ * @param reduce: callable with (T, T) returning T
+ * @param schedule: distribution of the iterations, static by default
+ * @param pool: executing pool, the global pool by default
+ * @return: T, reduced value
+ */
+template <typename Index, typename T, typename Map, typename Reduce>
+T parallel_reduce(Index first, Index last, T identity, Map&& map, Reduce&& reduce,
+                  Schedule schedule = schedule_static(), ThreadPool& pool = ThreadPool::get_global())
+{
+    if(!(first < last)){
+        return identity;
+    }
+    struct alignas(CACHE_LINE_SIZE) Partial{
+        T value;
+    };
+    const std::size_t n = std::size_t(last - first);
+    const std::size_t num_participants = get_num_participants(n, pool);
+    std::vector<Partial> partials(num_participants, Partial{identity});
+    for_each_chunk(n, num_participants, schedule, pool,
+                   [&](std::size_t begin, std::size_t end, std::size_t participant){
+        T local = partials[participant].value;
+        for(Index i = Index(first + begin); i < Index(first + end); i++){
+            local = reduce(local, map(i));
+        }
+        partials[participant].value = local;
+    });
+    T result = identity;
+    for(const Partial& partial : partials){
+        result = reduce(result, partial.value);
+    }
+    return result;
+}
+
+#endif // PARALLELFOR_HPP
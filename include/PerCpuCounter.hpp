@@ -0,0 +1,109 @@
+/**
+ * @file    : PerCpuCounter.hpp
+ * @brief   : Header file of per-CPU counter updated by restartable sequences
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef PERCPUCOUNTER_HPP
+#define PERCPUCOUNTER_HPP
+
+#include <cstddef>  //< for std::size_t
+#include <memory>   //< for std::unique_ptr
+#include "Rseq.hpp"
+#include "ShardedCounter.hpp"
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: PerCpuCounter
+ * @brief: counter with one cell per CPU. add() is a restartable sequence which
+ * adds to the cell of the current CPU with a plain add instruction, no lock
+ * prefix and no cache line transfer. Without rseq the adds go to a
+ * ShardedCounter, the two paths never share cells.
+ */
+class PerCpuCounter
+{
+private:
+    /**
+     * @brief: partial count of one CPU padded to a full cache line
+     */
+    struct alignas(CACHE_LINE_SIZE) Cell{
+        long value;     //< sum of the adds on this CPU, written by rseq only
+    };
+
+    std::unique_ptr<Cell[]> cells_;     //< partial counts per CPU
+    std::size_t num_cpus_;              //< number of cells
+    ShardedCounter<long> fallback_;     //< adds without rseq
+
+public:
+
+    /**
+     * @name: PerCpuCounter()
+     * @brief: Constructor, all cells are zero
+     */
+    PerCpuCounter()
+    {
+        num_cpus_ = rseq_get_num_cpus();
+        cells_.reset(new Cell[num_cpus_]);
+        for(std::size_t i = 0; i < num_cpus_; i++){
+            cells_[i].value = 0;
+        }
+    }
+
+    /**
+     * @name: PerCpuCounter()
+     * @brief: Copy Constructor is deleted, the cells are shared by the threads
+     */
+    PerCpuCounter(const PerCpuCounter& perCpuCounter)=delete;
+
+    /**
+     * @name: add()
+     * @brief: add a value to the cell of the current CPU
+     * @param delta: value to add
+     */
+    void add(long delta)
+    {
+        if(rseq_add(&cells_[0].value, sizeof(Cell), num_cpus_, delta) != RSEQ_DONE){
+            fallback_.add(delta);
+        }
+    }
+
+    /**
+     * @name: increment()
+     * @brief: add one to the counter
+     */
+    void increment()
+    {
+        add(1);
+    }
+
+    /**
+     * @name: get()
+     * @brief: return the sum of all cells, exact if no add is running. There is
+     * no reset(), a cell cannot be cleared without racing with its CPU.
+     * @return: long, aggregated count
+     */
+    long get() const
+    {
+        long sum = fallback_.get();
+        for(std::size_t i = 0; i < num_cpus_; i++){
+            sum += __atomic_load_n(&cells_[i].value, __ATOMIC_RELAXED);
+        }
+        return sum;
+    }
+
+    /**
+     * @name: uses_rseq()
+     * @brief: return if the calling thread adds with restartable sequences
+     * @return: boolean, false if it uses the ShardedCounter fallback
+     */
+    static bool uses_rseq()
+    {
+        return rseq_available();
+    }
+
+}; // class PerCpuCounter
+
+#endif // PERCPUCOUNTER_HPP
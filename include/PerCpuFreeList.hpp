@@ -0,0 +1,178 @@
+/**
+ * @file    : PerCpuFreeList.hpp
+ * @brief   : Header file of intrusive per-CPU free list updated by restartable
+ * sequences
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef PERCPUFREELIST_HPP
+#define PERCPUFREELIST_HPP
+
+#include <cstddef>      //< for std::size_t
+#include <memory>       //< for std::unique_ptr
+#include <type_traits>  //< for std::is_base_of
+#include "Rseq.hpp"
+#include "SpinLock.hpp"
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: PerCpuNode
+ * @brief: base of the nodes of a PerCpuFreeList, next must be the first word
+ */
+struct PerCpuNode{
+    PerCpuNode* next;   //< next free node
+};
+
+/**
+ * @name: PerCpuFreeList
+ * @brief: cache of free nodes, e.g. of an allocator, with one intrusive stack
+ * per CPU. push() and pop() are restartable sequences on the stack of the
+ * current CPU, they need neither atomics nor ABA protection since a sequence
+ * is restarted if another thread could have run on the CPU in between. A pop
+ * only sees the nodes of its CPU and returns nullptr if they are used up, the
+ * caller then allocates. Without rseq the nodes go to SpinLock protected
+ * stacks selected by the thread index, the two paths never share a stack.
+ * The list does not own the nodes.
+ */
+template <typename T>
+class PerCpuFreeList
+{
+    static_assert(std::is_base_of<PerCpuNode, T>::value, "PerCpuFreeList<T> requires T to derive from PerCpuNode");
+
+private:
+    /**
+     * @brief: top of the stack of one CPU padded to a full cache line
+     */
+    struct alignas(CACHE_LINE_SIZE) Head{
+        PerCpuNode* top;    //< top node, written by rseq only
+    };
+
+    /**
+     * @brief: stack of the fallback path padded to a full cache line
+     */
+    struct alignas(CACHE_LINE_SIZE) Shard{
+        SpinLock lock;      //< protects top
+        PerCpuNode* top;    //< top node
+    };
+
+    std::unique_ptr<Head[]> heads_;     //< stacks per CPU
+    std::size_t num_cpus_;              //< number of stacks per CPU
+    std::unique_ptr<Shard[]> shards_;   //< stacks without rseq
+    std::size_t num_shards_;            //< number of stacks without rseq
+
+    /**
+     * @name: get_shard()
+     * @brief: return the fallback stack of the calling thread
+     * @return: Shard&, stack of the thread index
+     */
+    Shard& get_shard()
+    {
+        return shards_[get_thread_index() % num_shards_];
+    }
+
+public:
+
+    /**
+     * @name: PerCpuFreeList()
+     * @brief: Constructor, all stacks are empty
+     */
+    PerCpuFreeList()
+    {
+        num_cpus_ = rseq_get_num_cpus();
+        heads_.reset(new Head[num_cpus_]);
+        for(std::size_t i = 0; i < num_cpus_; i++){
+            heads_[i].top = nullptr;
+        }
+        num_shards_ = num_cpus_;
+        shards_.reset(new Shard[num_shards_]);
+        for(std::size_t i = 0; i < num_shards_; i++){
+            shards_[i].top = nullptr;
+        }
+    }
+
+    /**
+     * @name: PerCpuFreeList()
+     * @brief: Copy Constructor is deleted, the stacks are shared by the threads
+     */
+    PerCpuFreeList(const PerCpuFreeList& perCpuFreeList)=delete;
+
+    /**
+     * @name: push()
+     * @brief: put a free node onto the stack of the current CPU
+     * @param node: pointer to the node, owned by the list until popped
+     */
+    void push(T* node)
+    {
+        PerCpuNode* base = node;
+        if(rseq_push(reinterpret_cast<void**>(&heads_[0].top), sizeof(Head), num_cpus_, base) != RSEQ_DONE){
+            Shard& shard = get_shard();
+            shard.lock.acquire();
+            base->next = shard.top;
+            shard.top = base;
+            shard.lock.release();
+        }
+    }
+
+    /**
+     * @name: pop()
+     * @brief: take a free node from the stack of the current CPU
+     * @return: T*, pointer to the node or nullptr if the stack is empty
+     */
+    T* pop()
+    {
+        void* node = nullptr;
+        const RseqStatus status = rseq_pop(reinterpret_cast<void**>(&heads_[0].top), sizeof(Head), num_cpus_, node);
+        if(status == RSEQ_DONE){
+            return static_cast<T*>(static_cast<PerCpuNode*>(node));
+        }
+        if(status == RSEQ_EMPTY){
+            return nullptr;
+        }
+        Shard& shard = get_shard();
+        shard.lock.acquire();
+        PerCpuNode* top = shard.top;
+        if(top != nullptr){
+            shard.top = top->next;
+        }
+        shard.lock.release();
+        return static_cast<T*>(top);
+    }
+
+    /**
+     * @name: flush()
+     * @brief: remove the nodes of all stacks, no push or pop may be running
+     * @param function: callable receiving every node, e.g. to free it
+     * @return: std::size_t, number of removed nodes
+     */
+    template <typename Function>
+    std::size_t flush(Function&& function)
+    {
+        std::size_t count = 0;
+        for(std::size_t i = 0; i < num_cpus_ + num_shards_; i++){
+            PerCpuNode*& top = (i < num_cpus_) ? heads_[i].top : shards_[i - num_cpus_].top;
+            while(top != nullptr){
+                PerCpuNode* node = top;
+                top = node->next;
+                function(static_cast<T*>(node));
+                count++;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @name: uses_rseq()
+     * @brief: return if the calling thread uses restartable sequences
+     * @return: boolean, false if it uses the SpinLock protected stacks
+     */
+    static bool uses_rseq()
+    {
+        return rseq_available();
+    }
+
+}; // class PerCpuFreeList
+
+#endif // PERCPUFREELIST_HPP
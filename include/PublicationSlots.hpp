@@ -0,0 +1,227 @@
+/**
+ * @file    : PublicationSlots.hpp
+ * @brief   : Header file of type-erased requests and per-thread publication slots
+ * shared by FlatCombiner and DelegationLock
+ * @author  : David Blickenstorfer
+ *
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef PUBLICATIONSLOTS_HPP
+#define PUBLICATIONSLOTS_HPP
+
+#include <atomic>       //< allow atomic variables to protect compiler optimization
+#include <cstddef>      //< for std::size_t
+#include <exception>    //< for std::exception_ptr
+#include <optional>     //< for std::optional
+#include <type_traits>  //< for std::invoke_result_t
+#include <utility>      //< for std::move
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: Request
+ * @brief: type-erased operation on a shared object T, lives on the stack of
+ * the publishing thread while another thread may execute it
+ */
+template <typename T>
+class Request
+{
+private:
+    void (*invoke_)(void* operation, T& data);  //< type-erased call of the operation
+    void* operation_;                           //< pointer to the operation
+    std::exception_ptr error_;                  //< exception thrown by the operation
+
+    /**
+     * @name: invoke()
+     * @brief: call the type-erased operation of type Operation
+     */
+    template <typename Operation>
+    static void invoke(void* operation, T& data)
+    {
+        (*static_cast<Operation*>(operation))(data);
+    }
+
+public:
+
+    /**
+     * @name: Request()
+     * @brief: Constructor
+     * @param operation: callable with signature void(T&), must outlive the request
+     */
+    template <typename Operation>
+    explicit Request(Operation& operation)
+        : invoke_(&invoke<Operation>), operation_(&operation), error_(nullptr)
+    {
+    }
+
+    /**
+     * @name: Request()
+     * @brief: Copy Constructor is deleted, executing threads refer to the request
+     */
+    Request(const Request& request)=delete;
+
+    /**
+     * @name: run()
+     * @brief: execute the operation, store its exception for the publisher
+     * @param data: shared object
+     */
+    void run(T& data)
+    {
+        try{
+            invoke_(operation_, data);
+        }catch(...){
+            error_ = std::current_exception();
+        }
+    }
+
+    /**
+     * @name: rethrow()
+     * @brief: rethrow the exception of the operation in the publishing thread
+     */
+    void rethrow() const
+    {
+        if(error_){
+            std::rethrow_exception(error_);
+        }
+    }
+
+}; // class Request
+
+/**
+ * @name: apply_request()
+ * @brief: wrap an operation with a result into a Request, execute it and
+ * return the result or rethrow the exception of the operation
+ * @param operation: callable with signature R(T&)
+ * @param execute: callable with signature void(Request<T>&), returns once the request ran
+ * @return: R, result of the operation
+ */
+template <typename T, typename Operation, typename Execute>
+std::invoke_result_t<Operation&, T&> apply_request(Operation& operation, Execute&& execute)
+{
+    using Result = std::invoke_result_t<Operation&, T&>;
+    if constexpr(std::is_void_v<Result>){
+        auto call = [&](T& data){ operation(data); };
+        Request<T> request(call);
+        execute(request);
+        request.rethrow();
+    }else{
+        std::optional<Result> result;
+        auto call = [&](T& data){ result.emplace(operation(data)); };
+        Request<T> request(call);
+        execute(request);
+        request.rethrow();
+        return std::move(*result);
+    }
+}
+
+/**
+ * @name: PublicationSlots
+ * @brief: NumSlots cache-line padded slots where threads publish a Request for
+ * another thread, picked by the thread index. Threads with the same index
+ * modulo NumSlots share a slot, publishing fails while it is occupied. Only
+ * the slots below the highest used index are scanned.
+ */
+template <typename T, std::size_t NumSlots>
+class PublicationSlots
+{
+    static_assert(NumSlots > 0, "PublicationSlots needs at least one slot");
+
+public:
+    /**
+     * @brief: publication slot, non-null while a request is pending
+     */
+    struct alignas(CACHE_LINE_SIZE) Slot{
+        std::atomic<Request<T>*> request{nullptr};
+    };
+
+private:
+    std::atomic<std::size_t> used_slots_;   //< slots below this index were used
+    Slot slots_[NumSlots];                  //< publication slots
+
+public:
+
+    /**
+     * @name: PublicationSlots()
+     * @brief: Constructor
+     */
+    PublicationSlots() : used_slots_(0) {}
+
+    /**
+     * @name: PublicationSlots()
+     * @brief: Copy Constructor is deleted, publishers refer to the slots
+     */
+    PublicationSlots(const PublicationSlots& publicationSlots)=delete;
+
+    /**
+     * @name: get_slot()
+     * @brief: return the slot of the calling thread and extend the range of
+     * scanned slots to it
+     * @return: Slot&, slot of the calling thread
+     */
+    Slot& get_slot()
+    {
+        const std::size_t index = get_thread_index() % NumSlots;
+        std::size_t used_slots = used_slots_.load(std::memory_order_relaxed);
+        // seq_cst, so a server scanning after its seq_cst fence sees the extended
+        // range whenever the publisher did not see it sleeping (DelegationLock);
+        // with release it could scan the old range and park on a published request
+        while(used_slots <= index && !used_slots_.compare_exchange_weak(used_slots, index + 1,
+                                                                          std::memory_order_seq_cst)){
+        }
+        return slots_[index];
+    }
+
+    /**
+     * @name: try_publish()
+     * @brief: publish a request in a slot if it is free
+     * @param slot: slot of the calling thread
+     * @param request: published request
+     * @param order: memory order of the publication, at least release
+     * @return: boolean, false if the slot is occupied by another thread
+     */
+    static bool try_publish(Slot& slot, Request<T>& request,
+                            std::memory_order order = std::memory_order_release)
+    {
+        Request<T>* empty = nullptr;
+        return slot.request.compare_exchange_strong(empty, &request, order, std::memory_order_relaxed);
+    }
+
+    /**
+     * @name: is_pending()
+     * @brief: return if a published request was not executed yet
+     * @param slot: slot of the request
+     * @param request: published request
+     * @return: boolean, true while the request waits for execution
+     */
+    static bool is_pending(const Slot& slot, const Request<T>& request)
+    {
+        return slot.request.load(std::memory_order_acquire) == &request;
+    }
+
+    /**
+     * @name: for_each_request()
+     * @brief: visit all published requests and clear their slots, which tells
+     * the publishers their request is done
+     * @param visit: callable with signature void(Request<T>&), executes the request
+     * @return: std::size_t, number of visited requests
+     */
+    template <typename Visit>
+    std::size_t for_each_request(Visit&& visit)
+    {
+        std::size_t num_visited = 0;
+        const std::size_t used_slots = used_slots_.load(std::memory_order_acquire);
+        for(std::size_t i = 0; i < used_slots; i++){
+            Request<T>* request = slots_[i].request.load(std::memory_order_acquire);
+            if(request != nullptr){
+                visit(*request);
+                num_visited++;
+                slots_[i].request.store(nullptr, std::memory_order_release);
+            }
+        }
+        return num_visited;
+    }
+
+}; // class PublicationSlots
+
+#endif // PUBLICATIONSLOTS_HPP
@@ -0,0 +1,212 @@
+/**
+ * @file    : Rseq.hpp
+ * @brief   : Header file of restartable sequences (rseq) for per-CPU operations
+ * without atomic instructions
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef RSEQ_HPP
+#define RSEQ_HPP
+
+#include <cstddef>  //< for std::size_t and offsetof
+
+// A restartable sequence reads the CPU number the kernel keeps in the rseq area
+// of the thread and ends with a single committing store. If the thread is
+// preempted, migrated or signaled before the commit, the kernel restarts it at
+// the abort handler, so the sequence runs as if the thread owned the CPU. The
+// area is registered by glibc (2.35 or newer). The sequences are implemented
+// for x86_64, elsewhere the callers use their fallback paths.
+#if defined(__x86_64__) && defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/rseq.h>)
+#define MYLIBRARY_HAVE_RSEQ
+#endif
+#endif
+
+#ifdef MYLIBRARY_HAVE_RSEQ
+#include <sys/rseq.h>   //< for struct rseq and the registration of glibc
+
+// descriptor of the sequence between labels 1 (start) and 2 (commit done) with
+// the abort handler at label 4, the kernel requires the signature of glibc
+// right before the handler, encoded as operand of an ud1 instruction
+#define RSEQ_SEQUENCE_BEGIN                                         \
+    ".pushsection __rseq_cs, \"aw\"\n\t"                            \
+    ".balign 32\n\t"                                                \
+    "3:\n\t"                                                        \
+    ".long 0, 0\n\t"                                                \
+    ".quad 1f, (2f - 1f), 4f\n\t"                                   \
+    ".popsection\n\t"                                               \
+    "leaq 3b(%%rip), %%rax\n\t"                                     \
+    "movq %%rax, %c[cs_offset](%[area])\n\t"                        \
+    "1:\n\t"                                                        \
+    "movl %c[cpu_offset](%[area]), %%eax\n\t"                       \
+    "cmpq %[num_cpus], %%rax\n\t"                                   \
+    "jae %l[unavailable]\n\t"
+
+#define RSEQ_SEQUENCE_END                                           \
+    "2:\n\t"                                                        \
+    ".pushsection __rseq_failure, \"ax\"\n\t"                       \
+    ".byte 0x0f, 0xb9, 0x3d\n\t"                                    \
+    ".long 0x53053053\n\t"                                          \
+    "4:\n\t"                                                        \
+    "jmp %l[abort]\n\t"                                             \
+    ".popsection\n\t"
+
+#define RSEQ_AREA_OPERANDS                                          \
+    [area] "r"(area),                                               \
+    [cs_offset] "i"(offsetof(struct rseq, rseq_cs)),                \
+    [cpu_offset] "i"(offsetof(struct rseq, cpu_id))
+#endif
+
+/**
+ * @brief: result of a restartable sequence
+ */
+enum RseqStatus{
+    RSEQ_DONE,          //< the sequence committed
+    RSEQ_EMPTY,         //< nothing to pop on the current CPU
+    RSEQ_UNAVAILABLE    //< no rseq area or CPU number out of range, use the fallback
+};
+
+/**
+ * @name: rseq_get_num_cpus()
+ * @brief: return the number of possible CPU numbers, i.e. the largest CPU
+ * number of the system plus one
+ * @return: std::size_t, number of per-CPU slots
+ */
+std::size_t rseq_get_num_cpus();
+
+/**
+ * @name: rseq_available()
+ * @brief: return if the calling thread has a registered rseq area
+ * @return: boolean, true if the restartable sequences can be used
+ */
+inline bool rseq_available()
+{
+#ifdef MYLIBRARY_HAVE_RSEQ
+    return __rseq_size > 0;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @name: rseq_add()
+ * @brief: add a value to the word of the current CPU without atomic instruction
+ * @param words: first per-CPU word, the words are stride bytes apart
+ * @param stride: distance of the words in bytes
+ * @param num_cpus: number of words
+ * @param delta: value to add
+ * @return: RseqStatus, RSEQ_DONE or RSEQ_UNAVAILABLE
+ */
+inline RseqStatus rseq_add(long* words, std::size_t stride, std::size_t num_cpus, long delta)
+{
+#ifdef MYLIBRARY_HAVE_RSEQ
+    if(!rseq_available()){
+        return RSEQ_UNAVAILABLE;
+    }
+    struct rseq* area = (struct rseq*)((char*)__builtin_thread_pointer() + __rseq_offset);
+abort:
+    asm goto(RSEQ_SEQUENCE_BEGIN
+             "imulq %[stride], %%rax\n\t"
+             "addq %[delta], (%[words], %%rax)\n\t"
+             RSEQ_SEQUENCE_END
+             : /* asm goto of GCC 10 cannot have outputs */
+             : RSEQ_AREA_OPERANDS, [num_cpus] "r"(num_cpus), [words] "r"(words),
+               [stride] "r"(stride), [delta] "r"(delta)
+             : "rax", "memory", "cc"
+             : abort, unavailable);
+    return RSEQ_DONE;
+unavailable:
+#else
+    (void)words; (void)stride; (void)num_cpus; (void)delta;
+#endif
+    return RSEQ_UNAVAILABLE;
+}
+
+/**
+ * @name: rseq_push()
+ * @brief: push a node onto the intrusive list of the current CPU, the first
+ * word of a node is its next pointer
+ * @param heads: head of the list of CPU 0, the heads are stride bytes apart
+ * @param stride: distance of the heads in bytes
+ * @param num_cpus: number of lists
+ * @param node: pointer to the node owned by the caller
+ * @return: RseqStatus, RSEQ_DONE or RSEQ_UNAVAILABLE
+ */
+inline RseqStatus rseq_push(void** heads, std::size_t stride, std::size_t num_cpus, void* node)
+{
+#ifdef MYLIBRARY_HAVE_RSEQ
+    if(!rseq_available()){
+        return RSEQ_UNAVAILABLE;
+    }
+    struct rseq* area = (struct rseq*)((char*)__builtin_thread_pointer() + __rseq_offset);
+abort:
+    asm goto(RSEQ_SEQUENCE_BEGIN
+             "imulq %[stride], %%rax\n\t"
+             "addq %[heads], %%rax\n\t"
+             "movq (%%rax), %%rcx\n\t"
+             "movq %%rcx, (%[node])\n\t"
+             // commit
+             "movq %[node], (%%rax)\n\t"
+             RSEQ_SEQUENCE_END
+             :
+             : RSEQ_AREA_OPERANDS, [num_cpus] "r"(num_cpus), [heads] "r"(heads),
+               [stride] "r"(stride), [node] "r"(node)
+             : "rax", "rcx", "memory", "cc"
+             : abort, unavailable);
+    return RSEQ_DONE;
+unavailable:
+#else
+    (void)heads; (void)stride; (void)num_cpus; (void)node;
+#endif
+    return RSEQ_UNAVAILABLE;
+}
+
+/**
+ * @name: rseq_pop()
+ * @brief: pop a node from the intrusive list of the current CPU, the first
+ * word of a node is its next pointer
+ * @param heads: head of the list of CPU 0, the heads are stride bytes apart
+ * @param stride: distance of the heads in bytes
+ * @param num_cpus: number of lists
+ * @param node: reference to store the popped node
+ * @return: RseqStatus, RSEQ_DONE, RSEQ_EMPTY or RSEQ_UNAVAILABLE
+ */
+inline RseqStatus rseq_pop(void** heads, std::size_t stride, std::size_t num_cpus, void*& node)
+{
+#ifdef MYLIBRARY_HAVE_RSEQ
+    if(!rseq_available()){
+        return RSEQ_UNAVAILABLE;
+    }
+    struct rseq* area = (struct rseq*)((char*)__builtin_thread_pointer() + __rseq_offset);
+    void** result = &node;
+abort:
+    asm goto(RSEQ_SEQUENCE_BEGIN
+             "imulq %[stride], %%rax\n\t"
+             "addq %[heads], %%rax\n\t"
+             "movq (%%rax), %%rcx\n\t"
+             "testq %%rcx, %%rcx\n\t"
+             "jz %l[empty]\n\t"
+             "movq (%%rcx), %%rdx\n\t"
+             "movq %%rcx, (%[result])\n\t"
+             // commit
+             "movq %%rdx, (%%rax)\n\t"
+             RSEQ_SEQUENCE_END
+             :
+             : RSEQ_AREA_OPERANDS, [num_cpus] "r"(num_cpus), [heads] "r"(heads),
+               [stride] "r"(stride), [result] "r"(result)
+             : "rax", "rcx", "rdx", "memory", "cc"
+             : abort, unavailable, empty);
+    return RSEQ_DONE;
+empty:
+    return RSEQ_EMPTY;
+unavailable:
+#else
+    (void)heads; (void)stride; (void)num_cpus; (void)node;
+#endif
+    return RSEQ_UNAVAILABLE;
+}
+
+#endif // RSEQ_HPP
@@ -0,0 +1,156 @@
+/**
+ * @file    : SeqLock.hpp
+ * @brief   : Header file of sequence lock for single-writer, many-reader snapshots
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef SEQLOCK_HPP
+#define SEQLOCK_HPP
+
+#include <thread>       //< allow multi-threading programming
+#include <atomic>       //< allow atomic variables to protect compiler optimization
+#include <cstring>      //< for std::memcpy
+#include <type_traits>  //< for std::is_trivially_copyable
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: SeqLock
+ * @brief: publish a trivially copyable value from one writer to many readers.
+ * The writer never waits, readers copy the value optimistically and retry if
+ * the sequence number changed in the meantime. Readers never write to shared memory.
+ * The payload is stored as relaxed atomic words, so the racy copy is well defined.
+ */
+template <typename T>
+class alignas(CACHE_LINE_SIZE) SeqLock
+{
+    static_assert(std::is_trivially_copyable<T>::value,
+                  "SeqLock<T> requires a trivially copyable T");
+
+private:
+    // number of machine words to store the payload
+    static constexpr std::size_t num_words_ = (sizeof(T) + sizeof(std::size_t) - 1) / sizeof(std::size_t);
+    // number of failed reads before the reader gives the writer its CPU
+    static constexpr unsigned int spins_before_yield_ = 64;
+
+    std::atomic<unsigned long> sequence_;       //< odd while the writer is updating
+    std::atomic<std::size_t> data_[num_words_]; //< payload stored as atomic words
+
+public:
+
+    /**
+     * @name: SeqLock()
+     * @brief: Default Constructor, the payload is value-initialized
+     */
+    SeqLock() : SeqLock(T{}) {}
+
+    /**
+     * @name: SeqLock()
+     * @brief: Constructor with initial payload
+     * @param value: initial snapshot
+     */
+    explicit SeqLock(const T& value)
+    {
+        sequence_.store(0, std::memory_order_relaxed);
+        std::size_t words[num_words_] = {};
+        std::memcpy(words, &value, sizeof(T));
+        for(std::size_t i = 0; i < num_words_; i++){
+            data_[i].store(words[i], std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @name: SeqLock()
+     * @brief: Copy Constructor is deleted, the version belongs to one location
+     */
+    SeqLock(const SeqLock& seqLock)=delete;
+
+    /**
+     * @name: SeqLock()
+     * @brief: Default Destructor
+     */
+    ~SeqLock()=default;
+
+    /**
+     * @name: store()
+     * @brief: publish a new snapshot, must only be called by the single writer
+     * @param value: new snapshot
+     */
+    void store(const T& value)
+    {
+        std::size_t words[num_words_] = {};
+        std::memcpy(words, &value, sizeof(T));
+
+        // odd sequence number marks the update, the fence keeps the payload
+        // stores behind the sequence number store
+        const unsigned long seq = sequence_.load(std::memory_order_relaxed);
+        sequence_.store(seq + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+        for(std::size_t i = 0; i < num_words_; i++){
+            data_[i].store(words[i], std::memory_order_relaxed);
+        }
+        // even sequence number publishes the update
+        sequence_.store(seq + 2, std::memory_order_release);
+    }
+
+    /**
+     * @name: try_load()
+     * @brief: try to read a consistent snapshot once, never blocks
+     * @param value: output, overwritten only on success
+     * @return: boolean, true if the snapshot is consistent
+     */
+    bool try_load(T& value) const
+    {
+        const unsigned long seq = sequence_.load(std::memory_order_acquire);
+        if(seq & 1){
+            return false;   //< writer is updating
+        }
+        std::size_t words[num_words_];
+        for(std::size_t i = 0; i < num_words_; i++){
+            words[i] = data_[i].load(std::memory_order_relaxed);
+        }
+        // the fence keeps the payload loads in front of the validation
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if(sequence_.load(std::memory_order_relaxed) != seq){
+            return false;   //< writer updated while copying
+        }
+        std::memcpy(&value, words, sizeof(T));
+        return true;
+    }
+
+    /**
+     * @name: load()
+     * @brief: read a consistent snapshot, retry until no update interfered
+     * @return: T, consistent snapshot
+     */
+    T load() const
+    {
+        T value;
+        unsigned int spins = 0;
+        while(!try_load(value)){
+            if(++spins < spins_before_yield_){
+                cpu_relax();
+            }else{
+                // the writer might be preempted in the middle of an update
+                std::this_thread::yield();
+                spins = 0;
+            }
+        }
+        return value;
+    }
+
+    /**
+     * @name: get_version()
+     * @brief: return the number of published snapshots
+     * @return: unsigned long, number of completed store() calls
+     */
+    unsigned long get_version() const
+    {
+        return sequence_.load(std::memory_order_acquire) / 2;
+    }
+
+}; // class SeqLock
+
+#endif // SEQLOCK_HPP
@@ -0,0 +1,129 @@
+/**
+ * @file    : ShardedCounter.hpp
+ * @brief   : Header file of scalable counter sharded into per-thread cells
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef SHARDEDCOUNTER_HPP
+#define SHARDEDCOUNTER_HPP
+
+#include <atomic>   //< allow atomic variables to protect compiler optimization
+#include <cstddef>  //< for std::size_t
+#include <memory>   //< for std::unique_ptr
+#include <thread>   //< for std::thread::hardware_concurrency
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: ShardedCounter
+ * @brief: counter split into cells on separate cache lines. A thread always
+ * adds to the cell of its thread index, so with no more threads than cells no
+ * two threads write the same line and add() costs an uncontended relaxed
+ * fetch_add. Additional threads share cells, add() stays wait-free. Reading
+ * sums all cells, which is exact once the adds are finished and otherwise lies
+ * between the values at the start and the end of the read for monotone counts.
+ */
+template <typename T = long>
+class ShardedCounter
+{
+private:
+    /**
+     * @brief: partial count padded to a full cache line
+     */
+    struct alignas(CACHE_LINE_SIZE) Cell{
+        std::atomic<T> value;   //< sum of the adds of the threads of this cell
+    };
+
+    std::unique_ptr<Cell[]> cells_; //< partial counts
+    std::size_t mask_;              //< number of cells - 1, a power of two - 1
+
+public:
+
+    /**
+     * @name: ShardedCounter()
+     * @brief: Constructor, all cells are zero
+     * @param num_cells: number of cells rounded up to a power of two, the
+     * number of hardware threads by default
+     */
+    explicit ShardedCounter(std::size_t num_cells = std::thread::hardware_concurrency())
+    {
+        std::size_t size = 1;
+        while(size < num_cells){
+            size *= 2;
+        }
+        cells_.reset(new Cell[size]);
+        mask_ = size - 1;
+        for(std::size_t i = 0; i < size; i++){
+            cells_[i].value.store(T(0), std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @name: ShardedCounter()
+     * @brief: Copy Constructor is deleted, the cells are shared by the threads
+     */
+    ShardedCounter(const ShardedCounter& shardedCounter)=delete;
+
+    /**
+     * @name: add()
+     * @brief: add a value to the cell of the calling thread, wait-free
+     * @param delta: value to add
+     */
+    void add(T delta)
+    {
+        cells_[get_thread_index() & mask_].value.fetch_add(delta, std::memory_order_relaxed);
+    }
+
+    /**
+     * @name: increment()
+     * @brief: add one to the counter
+     */
+    void increment()
+    {
+        add(T(1));
+    }
+
+    /**
+     * @name: get()
+     * @brief: return the sum of all cells, exact if no add is running
+     * @return: T, aggregated count
+     */
+    T get() const
+    {
+        T sum = T(0);
+        for(std::size_t i = 0; i <= mask_; i++){
+            sum += cells_[i].value.load(std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    /**
+     * @name: reset()
+     * @brief: set all cells to zero and return their sum, concurrent adds are
+     * counted either by this or by the next reset()
+     * @return: T, aggregated count before the reset
+     */
+    T reset()
+    {
+        T sum = T(0);
+        for(std::size_t i = 0; i <= mask_; i++){
+            sum += cells_[i].value.exchange(T(0), std::memory_order_relaxed);
+        }
+        return sum;
+    }
+
+    /**
+     * @name: get_num_cells()
+     * @brief: return the number of cells
+     * @return: std::size_t, number of cells
+     */
+    std::size_t get_num_cells() const
+    {
+        return mask_ + 1;
+    }
+
+}; // class ShardedCounter
+
+#endif // SHARDEDCOUNTER_HPP
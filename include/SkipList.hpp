@@ -0,0 +1,411 @@
+/**
+ * @file    : SkipList.hpp
+ * @brief   : Header file of lock-free skip list with epoch-based reclamation
+ * for ordered keys
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef SKIPLIST_HPP
+#define SKIPLIST_HPP
+
+#include <atomic>       //< allow atomic variables to protect compiler optimization
+#include <cstddef>      //< for std::size_t
+#include <cstdint>      //< for uintptr_t and uint64_t
+#include <functional>   //< for std::less
+#include <new>          //< for placement new
+#include "EpochDomain.hpp"
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: SkipList
+ * @brief: ordered map as lock-free skip list (Fraser, Herlihy and Shavit). A
+ * node is in the map while it is linked at level 0 and unmarked. erase() marks
+ * the next pointers of a node from the top level down, the thread marking
+ * level 0 owns the removal. Traversals of writers unlink the marked nodes they
+ * pass with a CAS, readers skip them without writing. Nodes are immutable, so
+ * a reader under an EpochDomain::Guard can use a node even if it is removed
+ * concurrently. A node is retired once both its inserter finished linking the
+ * upper levels and its eraser finished unlinking, since a delayed inserter
+ * could link it again at an upper level.
+ */
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class SkipList
+{
+private:
+    // maximal number of levels, enough for 2^24 keys at p = 1/2
+    static const unsigned int max_level_ = 24;
+    // mark bit of a next pointer, set if the owning node is removed
+    static const uintptr_t mark_ = 1;
+
+    /**
+     * @brief: node with its next pointers allocated behind it
+     */
+    struct Node{
+        Key key;                    //< immutable key
+        Value value;                //< immutable value
+        unsigned int level;         //< number of next pointers
+        std::atomic<int> owners;    //< inserter and eraser still using the node
+
+        Node(const Key& key, const Value& value, unsigned int level)
+            : key(key), value(value), level(level), owners(2) {}
+
+        // offset of the next pointers behind the node
+        static constexpr std::size_t next_offset =
+            (sizeof(Node) + alignof(std::atomic<uintptr_t>) - 1) / alignof(std::atomic<uintptr_t>) * alignof(std::atomic<uintptr_t>);
+
+        std::atomic<uintptr_t>* next()
+        {
+            return reinterpret_cast<std::atomic<uintptr_t>*>(reinterpret_cast<char*>(this) + next_offset);
+        }
+
+        static Node* create(const Key& key, const Value& value, unsigned int level)
+        {
+            void* memory = ::operator new(next_offset + level * sizeof(std::atomic<uintptr_t>));
+            Node* node = new(memory) Node(key, value, level);
+            for(unsigned int i = 0; i < level; i++){
+                new(&node->next()[i]) std::atomic<uintptr_t>(0);
+            }
+            return node;
+        }
+
+        // pairs with create(), delete of a node frees the next pointers too
+        static void operator delete(void* memory) { ::operator delete(memory); }
+    };
+
+    static bool is_marked(uintptr_t link) { return (link & mark_) != 0; }
+    static Node* get_node(uintptr_t link) { return reinterpret_cast<Node*>(link & ~mark_); }
+    static uintptr_t make_link(Node* node) { return reinterpret_cast<uintptr_t>(node); }
+
+    EpochDomain& domain_;                                           //< reclaims removed nodes
+    Compare less_;                                                  //< strict weak order of the keys
+    alignas(CACHE_LINE_SIZE) std::atomic<uintptr_t> head_[max_level_];  //< next pointers of the head
+
+    /**
+     * @name: random_level()
+     * @brief: return a random number of levels, geometric with p = 1/2
+     * @return: unsigned int, level in [1, max_level_]
+     */
+    static unsigned int random_level()
+    {
+        thread_local uint64_t state = 0x9E3779B97F4A7C15ull * (get_thread_index() + 1);
+        // xorshift64
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        const unsigned int level = 1 + __builtin_ctzll(state | (1ull << (max_level_ - 1)));
+        return level;
+    }
+
+    /**
+     * @name: is_equal()
+     * @brief: return if two keys are equivalent
+     */
+    bool is_equal(const Key& a, const Key& b) const
+    {
+        return !less_(a, b) && !less_(b, a);
+    }
+
+    /**
+     * @name: find()
+     * @brief: search the predecessors and successors of a key on all levels and
+     * unlink the marked nodes on the way, restarts if an unlink fails
+     * @param key: searched key
+     * @param preds: output, next pointers of the last node before the key per level
+     * @param succs: output, first unmarked node not before the key per level
+     * @return: boolean, true if succs[0] holds the key
+     */
+    bool find(const Key& key, std::atomic<uintptr_t>** preds, Node** succs)
+    {
+    retry:
+        std::atomic<uintptr_t>* pred = head_;
+        for(int level = max_level_ - 1; level >= 0; level--){
+            Node* curr = get_node(pred[level].load(std::memory_order_acquire));
+            while(curr != nullptr){
+                uintptr_t succ = curr->next()[level].load(std::memory_order_acquire);
+                while(is_marked(succ)){
+                    uintptr_t expected = make_link(curr);
+                    if(!pred[level].compare_exchange_strong(expected, succ & ~mark_, std::memory_order_acq_rel,
+                                                            std::memory_order_acquire)){
+                        goto retry;
+                    }
+                    curr = get_node(succ);
+                    if(curr == nullptr){
+                        break;
+                    }
+                    succ = curr->next()[level].load(std::memory_order_acquire);
+                }
+                if(curr == nullptr || !less_(curr->key, key)){
+                    break;
+                }
+                pred = curr->next();
+                curr = get_node(succ);
+            }
+            preds[level] = &pred[level];
+            succs[level] = curr;
+        }
+        return succs[0] != nullptr && is_equal(succs[0]->key, key);
+    }
+
+    /**
+     * @name: find_first()
+     * @brief: return the first unmarked node not before a key, read-only
+     * traversal which skips the marked nodes
+     * @param key: searched key
+     * @return: Node*, node or nullptr if all keys are before the key
+     */
+    Node* find_first(const Key& key)
+    {
+        std::atomic<uintptr_t>* pred = head_;
+        Node* curr = nullptr;
+        for(int level = max_level_ - 1; level >= 0; level--){
+            curr = get_node(pred[level].load(std::memory_order_acquire));
+            while(curr != nullptr){
+                const uintptr_t succ = curr->next()[level].load(std::memory_order_acquire);
+                if(is_marked(succ)){
+                    curr = get_node(succ);
+                    continue;
+                }
+                if(!less_(curr->key, key)){
+                    break;
+                }
+                pred = curr->next();
+                curr = get_node(succ);
+            }
+        }
+        return curr;
+    }
+
+    /**
+     * @name: release()
+     * @brief: drop the inserter's or eraser's use of a node, the last one retires it
+     * @param node: node which is unlinked if it was removed
+     */
+    void release(Node* node)
+    {
+        if(node->owners.fetch_sub(1, std::memory_order_acq_rel) == 1){
+            domain_.retire(node);
+        }
+    }
+
+public:
+
+    /**
+     * @name: SkipList()
+     * @brief: Constructor of an empty map
+     * @param domain: domain reclaiming removed nodes, the global domain by default
+     */
+    explicit SkipList(EpochDomain& domain = EpochDomain::get_global())
+        : domain_(domain)
+    {
+        for(unsigned int i = 0; i < max_level_; i++){
+            head_[i].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @name: SkipList()
+     * @brief: Copy Constructor is deleted, nodes may still be used by readers
+     */
+    SkipList(const SkipList& skipList)=delete;
+
+    /**
+     * @name: ~SkipList()
+     * @brief: Destructor, frees the nodes in the map, no operation may be running
+     */
+    ~SkipList()
+    {
+        Node* node = get_node(head_[0].load(std::memory_order_relaxed));
+        while(node != nullptr){
+            Node* next = get_node(node->next()[0].load(std::memory_order_relaxed));
+            delete node;
+            node = next;
+        }
+    }
+
+    /**
+     * @name: insert()
+     * @brief: insert a key if it is not in the map, lock-free
+     * @param key: key
+     * @param value: value of the key
+     * @return: boolean, false if the key was already in the map
+     */
+    bool insert(const Key& key, const Value& value)
+    {
+        EpochDomain::Guard guard(domain_);
+        std::atomic<uintptr_t>* preds[max_level_];
+        Node* succs[max_level_];
+        const unsigned int level = random_level();
+        Node* node = nullptr;
+        while(true){
+            if(find(key, preds, succs)){
+                delete node;
+                return false;
+            }
+            if(node == nullptr){
+                node = Node::create(key, value, level);
+            }
+            for(unsigned int i = 0; i < level; i++){
+                node->next()[i].store(make_link(succs[i]), std::memory_order_relaxed);
+            }
+            // linking level 0 inserts the key
+            uintptr_t expected = make_link(succs[0]);
+            if(preds[0]->compare_exchange_strong(expected, make_link(node), std::memory_order_release,
+                                                 std::memory_order_relaxed)){
+                break;
+            }
+        }
+        for(unsigned int i = 1; i < level; i++){
+            while(true){
+                uintptr_t next = node->next()[i].load(std::memory_order_acquire);
+                // an eraser marked the node, stop linking it
+                if(is_marked(next)){
+                    goto linked;
+                }
+                if(get_node(next) != succs[i] &&
+                   !node->next()[i].compare_exchange_strong(next, make_link(succs[i]), std::memory_order_release,
+                                                            std::memory_order_relaxed)){
+                    continue;
+                }
+                uintptr_t expected = make_link(succs[i]);
+                if(preds[i]->compare_exchange_strong(expected, make_link(node), std::memory_order_release,
+                                                     std::memory_order_relaxed)){
+                    break;
+                }
+                find(key, preds, succs);
+                if(is_marked(node->next()[0].load(std::memory_order_acquire))){
+                    goto linked;
+                }
+            }
+        }
+    linked:
+        // a node erased while it was linked may have been linked again above, unlink it
+        if(is_marked(node->next()[0].load(std::memory_order_acquire))){
+            find(key, preds, succs);
+        }
+        release(node);
+        return true;
+    }
+
+    /**
+     * @name: erase()
+     * @brief: remove a key, lock-free
+     * @param key: key
+     * @return: boolean, false if the key was not in the map
+     */
+    bool erase(const Key& key)
+    {
+        EpochDomain::Guard guard(domain_);
+        std::atomic<uintptr_t>* preds[max_level_];
+        Node* succs[max_level_];
+        if(!find(key, preds, succs)){
+            return false;
+        }
+        Node* node = succs[0];
+        for(int i = int(node->level) - 1; i >= 1; i--){
+            uintptr_t next = node->next()[i].load(std::memory_order_acquire);
+            while(!is_marked(next) &&
+                  !node->next()[i].compare_exchange_weak(next, next | mark_, std::memory_order_acq_rel,
+                                                         std::memory_order_acquire)){
+            }
+        }
+        uintptr_t next = node->next()[0].load(std::memory_order_acquire);
+        while(true){
+            if(is_marked(next)){
+                // another eraser removed the node first
+                return false;
+            }
+            if(node->next()[0].compare_exchange_weak(next, next | mark_, std::memory_order_acq_rel,
+                                                     std::memory_order_acquire)){
+                break;
+            }
+        }
+        find(key, preds, succs);
+        release(node);
+        return true;
+    }
+
+    /**
+     * @name: find()
+     * @brief: look up a key without writing shared memory
+     * @param key: key
+     * @param value: output, overwritten only if the key was found
+     * @return: boolean, true if the key was found
+     */
+    bool find(const Key& key, Value& value)
+    {
+        EpochDomain::Guard guard(domain_);
+        Node* node = find_first(key);
+        if(node != nullptr && is_equal(node->key, key)){
+            value = node->value;
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @name: contains()
+     * @brief: return if a key is in the map
+     * @param key: key
+     * @return: boolean, true if the key was found
+     */
+    bool contains(const Key& key)
+    {
+        Value value;
+        return find(key, value);
+    }
+
+    /**
+     * @name: for_each()
+     * @brief: call a function for the keys in [first, last) in ascending order.
+     * Weakly consistent: every key in the range during the whole iteration is
+     * visited, keys inserted or erased concurrently may be visited or not.
+     * @param first: smallest key of the range
+     * @param last: end of the range, excluded
+     * @param function: callable receiving (const Key&, const Value&), runs under
+     * an epoch guard and must not block for long
+     * @return: std::size_t, number of visited keys
+     */
+    template <typename Function>
+    std::size_t for_each(const Key& first, const Key& last, Function&& function)
+    {
+        EpochDomain::Guard guard(domain_);
+        std::size_t count = 0;
+        Node* node = find_first(first);
+        while(node != nullptr && less_(node->key, last)){
+            const uintptr_t next = node->next()[0].load(std::memory_order_acquire);
+            if(!is_marked(next)){
+                function(node->key, node->value);
+                count++;
+            }
+            node = get_node(next);
+        }
+        return count;
+    }
+
+    /**
+     * @name: empty()
+     * @brief: return if the map is empty, a snapshot under concurrency
+     * @return: boolean, true if no key was found
+     */
+    bool empty()
+    {
+        EpochDomain::Guard guard(domain_);
+        std::atomic<uintptr_t>* link = head_;
+        while(true){
+            Node* node = get_node(link[0].load(std::memory_order_acquire));
+            if(node == nullptr){
+                return true;
+            }
+            if(!is_marked(node->next()[0].load(std::memory_order_acquire))){
+                return false;
+            }
+            link = node->next();
+        }
+    }
+
+}; // class SkipList
+
+#endif // SKIPLIST_HPP
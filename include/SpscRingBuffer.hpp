@@ -0,0 +1,224 @@
+/**
+ * @file    : SpscRingBuffer.hpp
+ * @brief   : Header file of bounded lock-free single-producer/single-consumer
+ * ring buffer
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef SPSCRINGBUFFER_HPP
+#define SPSCRINGBUFFER_HPP
+
+#include <atomic>   //< allow atomic variables to protect compiler optimization
+#include <cstddef>  //< for std::size_t
+#include <memory>   //< for std::unique_ptr
+#include <utility>  //< for std::move
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: SpscRingBuffer
+ * @brief: bounded lock-free ring buffer for exactly one producer thread and one
+ * consumer thread. head_ and tail_ are free running counters masked with the
+ * power-of-two capacity, so all slots are usable and no modulo is needed. Each
+ * side keeps a cached copy of the other side's index on its own cache line and
+ * reloads the shared index only when the cached one says full or empty, which
+ * keeps the index lines from bouncing on every operation.
+ */
+template <typename T>
+class SpscRingBuffer
+{
+private:
+    std::unique_ptr<T[]> buffer_;   //< slots
+    std::size_t mask_;              //< capacity - 1
+
+    // producer line: written by the producer, tail_ read by the consumer
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> tail_;   //< next slot to write
+    std::size_t cached_head_;                                   //< producer's copy of head_
+
+    // consumer line: written by the consumer, head_ read by the producer
+    alignas(CACHE_LINE_SIZE) std::atomic<std::size_t> head_;   //< next slot to read
+    std::size_t cached_tail_;                                   //< consumer's copy of tail_
+
+    /**
+     * @name: get_free_slots()
+     * @brief: return the number of writable slots, producer only
+     * @param tail: current tail of the producer
+     * @param wanted: number of slots needed, the head is reloaded only if the cache has less
+     * @return: std::size_t, number of writable slots
+     */
+    std::size_t get_free_slots(std::size_t tail, std::size_t wanted)
+    {
+        std::size_t free_slots = mask_ + 1 - (tail - cached_head_);
+        if(free_slots < wanted){
+            // acquire: the consumer is done with the slots before head_
+            cached_head_ = head_.load(std::memory_order_acquire);
+            free_slots = mask_ + 1 - (tail - cached_head_);
+        }
+        return free_slots;
+    }
+
+    /**
+     * @name: get_filled_slots()
+     * @brief: return the number of readable slots, consumer only
+     * @param head: current head of the consumer
+     * @param wanted: number of slots needed, the tail is reloaded only if the cache has less
+     * @return: std::size_t, number of readable slots
+     */
+    std::size_t get_filled_slots(std::size_t head, std::size_t wanted)
+    {
+        std::size_t filled_slots = cached_tail_ - head;
+        if(filled_slots < wanted){
+            // acquire: the values before tail_ are published
+            cached_tail_ = tail_.load(std::memory_order_acquire);
+            filled_slots = cached_tail_ - head;
+        }
+        return filled_slots;
+    }
+
+public:
+
+    /**
+     * @name: SpscRingBuffer()
+     * @brief: Constructor, allocate the slots once
+     * @param capacity: minimal number of slots, rounded up to a power of two
+     */
+    explicit SpscRingBuffer(std::size_t capacity)
+    {
+        std::size_t rounded = 1;
+        while(rounded < capacity){
+            rounded <<= 1;
+        }
+        buffer_.reset(new T[rounded]);
+        mask_ = rounded - 1;
+        tail_.store(0, std::memory_order_relaxed);
+        head_.store(0, std::memory_order_relaxed);
+        cached_head_ = 0;
+        cached_tail_ = 0;
+    }
+
+    /**
+     * @name: SpscRingBuffer()
+     * @brief: Copy Constructor is deleted, threads refer to the slots
+     */
+    SpscRingBuffer(const SpscRingBuffer& spscRingBuffer)=delete;
+
+    /**
+     * @name: ~SpscRingBuffer()
+     * @brief: Default Destructor
+     */
+    ~SpscRingBuffer()=default;
+
+    /**
+     * @name: push()
+     * @brief: append a value, producer only
+     * @param value: value to store
+     * @return: boolean, false if the buffer is full
+     */
+    bool push(const T& value)
+    {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        if(get_free_slots(tail, 1) == 0){
+            return false;
+        }
+        buffer_[tail & mask_] = value;
+        // release: publish the value with the new tail
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @name: push()
+     * @brief: append as many values as fit with a single publication, producer only
+     * @param values: pointer to the first value
+     * @param count: number of values
+     * @return: std::size_t, number of values appended from the front of values
+     */
+    std::size_t push(const T* values, std::size_t count)
+    {
+        const std::size_t tail = tail_.load(std::memory_order_relaxed);
+        const std::size_t free_slots = get_free_slots(tail, count);
+        const std::size_t num_values = (count < free_slots) ? count : free_slots;
+        for(std::size_t i = 0; i < num_values; i++){
+            buffer_[(tail + i) & mask_] = values[i];
+        }
+        if(num_values > 0){
+            tail_.store(tail + num_values, std::memory_order_release);
+        }
+        return num_values;
+    }
+
+    /**
+     * @name: pop()
+     * @brief: remove the oldest value, consumer only
+     * @param value: output, overwritten only on success
+     * @return: boolean, false if the buffer is empty
+     */
+    bool pop(T& value)
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        if(get_filled_slots(head, 1) == 0){
+            return false;
+        }
+        value = std::move(buffer_[head & mask_]);
+        // release: the slot may be overwritten after the new head is seen
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @name: pop()
+     * @brief: remove up to max_count oldest values with a single publication, consumer only
+     * @param values: output array with at least max_count elements
+     * @param max_count: maximal number of values
+     * @return: std::size_t, number of values written to the front of values
+     */
+    std::size_t pop(T* values, std::size_t max_count)
+    {
+        const std::size_t head = head_.load(std::memory_order_relaxed);
+        const std::size_t filled_slots = get_filled_slots(head, max_count);
+        const std::size_t num_values = (max_count < filled_slots) ? max_count : filled_slots;
+        for(std::size_t i = 0; i < num_values; i++){
+            values[i] = std::move(buffer_[(head + i) & mask_]);
+        }
+        if(num_values > 0){
+            head_.store(head + num_values, std::memory_order_release);
+        }
+        return num_values;
+    }
+
+    /**
+     * @name: size()
+     * @brief: return the number of stored values, only a snapshot under concurrency
+     * @return: std::size_t, number of stored values
+     */
+    std::size_t size() const
+    {
+        const std::size_t head = head_.load(std::memory_order_acquire);
+        return tail_.load(std::memory_order_acquire) - head;
+    }
+
+    /**
+     * @name: empty()
+     * @brief: return if the buffer is empty, only a snapshot under concurrency
+     * @return: boolean, true if the buffer is empty
+     */
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @name: get_capacity()
+     * @brief: return the number of slots
+     * @return: std::size_t, power of two
+     */
+    std::size_t get_capacity() const
+    {
+        return mask_ + 1;
+    }
+
+}; // class SpscRingBuffer
+
+#endif // SPSCRINGBUFFER_HPP
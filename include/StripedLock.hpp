@@ -0,0 +1,259 @@
+/**
+ * @file    : StripedLock.hpp
+ * @brief   : Header file of striped lock array for partitioned locking
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef STRIPEDLOCK_HPP
+#define STRIPEDLOCK_HPP
+
+#include <cstddef>      //< for std::size_t
+#include <cstdint>      //< for uint64_t and uintptr_t
+#include <array>        //< for std::array
+#include <algorithm>    //< for std::sort and std::unique
+#include <functional>   //< for std::hash
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: StripedLock
+ * @brief: N locks, each on its own cache line. Keys and addresses are mapped
+ * to stripes by a multiplicative hash. Several stripes are always acquired in
+ * ascending order, so multi-stripe acquisitions cannot deadlock.
+ */
+template <typename Lock, std::size_t N>
+class StripedLock
+{
+    static_assert(N > 0, "StripedLock needs at least one stripe");
+
+private:
+    /**
+     * @brief: lock padded to a full cache line
+     */
+    struct alignas(CACHE_LINE_SIZE) Stripe{
+        Lock lock;
+    };
+
+    Stripe stripes_[N]; //< padded locks
+
+    /**
+     * @name: reduce()
+     * @brief: map a hash value to [0, N), Fibonacci hashing scrambles the
+     * low-entropy bits of identity hashes, the multiply-shift reduction avoids
+     * the division of a modulo
+     * @param hash: uint64_t, hash value
+     * @return: std::size_t, stripe index
+     */
+    static std::size_t reduce(uint64_t hash)
+    {
+        const uint64_t mixed = hash * 0x9E3779B97F4A7C15ull;
+        return static_cast<std::size_t>((static_cast<unsigned __int128>(mixed) * N) >> 64);
+    }
+
+public:
+
+    /**
+     * @name: Guard
+     * @brief: RAII ownership of up to K stripes, released in reverse order
+     */
+    template <std::size_t K>
+    class Guard
+    {
+    private:
+        StripedLock* owner_;                //< striped lock of the stripes
+        std::array<std::size_t, K> stripes_;//< sorted unique stripe indices
+        std::size_t count_;                 //< number of owned stripes
+
+    public:
+        /**
+         * @name: Guard()
+         * @brief: Constructor, lock the stripes in ascending order
+         * @param owner: striped lock of the stripes
+         * @param stripes: stripe indices, duplicates are allowed
+         */
+        Guard(StripedLock& owner, const std::array<std::size_t, K>& stripes)
+            : owner_(&owner), stripes_(stripes)
+        {
+            count_ = owner_->acquire_stripes(stripes_.data(), K);
+        }
+
+        /**
+         * @name: Guard()
+         * @brief: Copy Constructor is deleted, the stripes are owned once
+         */
+        Guard(const Guard& guard)=delete;
+
+        /**
+         * @name: Guard()
+         * @brief: Move Constructor, transfer the ownership of the stripes
+         */
+        Guard(Guard&& guard) : owner_(guard.owner_), stripes_(guard.stripes_), count_(guard.count_)
+        {
+            guard.owner_ = nullptr;
+        }
+
+        /**
+         * @name: Guard()
+         * @brief: Destructor, unlock the stripes in descending order
+         */
+        ~Guard()
+        {
+            if(owner_ != nullptr){
+                owner_->release_stripes(stripes_.data(), count_);
+            }
+        }
+    }; // class Guard
+
+    /**
+     * @name: StripedLock()
+     * @brief: Default Constructor
+     */
+    StripedLock()=default;
+
+    /**
+     * @name: StripedLock()
+     * @brief: Copy Constructor is deleted, waiters refer to the stripes
+     */
+    StripedLock(const StripedLock& stripedLock)=delete;
+
+    /**
+     * @name: StripedLock()
+     * @brief: Default Destructor
+     */
+    ~StripedLock()=default;
+
+    /**
+     * @name: get_num_stripes()
+     * @brief: return the number of stripes
+     * @return: std::size_t, N
+     */
+    static constexpr std::size_t get_num_stripes() { return N; }
+
+    /**
+     * @name: get_stripe_of()
+     * @brief: return the stripe of a key
+     * @param key: key hashed with std::hash<Key>
+     * @return: std::size_t, stripe index in [0, N)
+     */
+    template <typename Key>
+    static std::size_t get_stripe_of(const Key& key)
+    {
+        return reduce(std::hash<Key>{}(key));
+    }
+
+    /**
+     * @name: get_stripe_of_address()
+     * @brief: return the stripe of an address
+     * @param address: pointer to the protected object
+     * @return: std::size_t, stripe index in [0, N)
+     */
+    static std::size_t get_stripe_of_address(const void* address)
+    {
+        return reduce(reinterpret_cast<uintptr_t>(address));
+    }
+
+    /**
+     * @name: get_lock()
+     * @brief: return the lock of a stripe
+     * @param stripe: std::size_t, stripe index in [0, N)
+     * @return: Lock&, lock of the stripe
+     */
+    Lock& get_lock(std::size_t stripe) { return stripes_[stripe].lock; }
+
+    /**
+     * @name: acquire()
+     * @brief: lock the stripe of a key
+     * @param key: key hashed with std::hash<Key>
+     */
+    template <typename Key>
+    void acquire(const Key& key) { stripes_[get_stripe_of(key)].lock.acquire(); }
+
+    /**
+     * @name: release()
+     * @brief: unlock the stripe of a key
+     * @param key: key hashed with std::hash<Key>
+     */
+    template <typename Key>
+    void release(const Key& key) { stripes_[get_stripe_of(key)].lock.release(); }
+
+    /**
+     * @name: acquire_stripes()
+     * @brief: lock several stripes in ascending order, duplicates are locked once
+     * @param stripes: array of stripe indices, sorted and deduplicated in place
+     * @param count: std::size_t, number of stripe indices
+     * @return: std::size_t, number of distinct locked stripes (front of stripes)
+     */
+    std::size_t acquire_stripes(std::size_t* stripes, std::size_t count)
+    {
+        std::sort(stripes, stripes + count);
+        const std::size_t distinct = std::unique(stripes, stripes + count) - stripes;
+        for(std::size_t i = 0; i < distinct; i++){
+            stripes_[stripes[i]].lock.acquire();
+        }
+        return distinct;
+    }
+
+    /**
+     * @name: release_stripes()
+     * @brief: unlock stripes locked by acquire_stripes() in reverse order
+     * @param stripes: array of distinct stripe indices
+     * @param count: std::size_t, number of distinct stripe indices
+     */
+    void release_stripes(const std::size_t* stripes, std::size_t count)
+    {
+        for(std::size_t i = count; i > 0; i--){
+            stripes_[stripes[i - 1]].lock.release();
+        }
+    }
+
+    /**
+     * @name: acquire_all()
+     * @brief: lock all stripes in ascending order, e.g. to resize a table
+     */
+    void acquire_all()
+    {
+        for(std::size_t i = 0; i < N; i++){
+            stripes_[i].lock.acquire();
+        }
+    }
+
+    /**
+     * @name: release_all()
+     * @brief: unlock all stripes
+     */
+    void release_all()
+    {
+        for(std::size_t i = N; i > 0; i--){
+            stripes_[i - 1].lock.release();
+        }
+    }
+
+    /**
+     * @name: lock_keys()
+     * @brief: lock the stripes of several keys without deadlock
+     * @param keys: keys hashed with std::hash
+     * @return: Guard, releases the stripes when destroyed
+     */
+    template <typename... Keys>
+    Guard<sizeof...(Keys)> lock_keys(const Keys&... keys)
+    {
+        return Guard<sizeof...(Keys)>(*this, {get_stripe_of(keys)...});
+    }
+
+    /**
+     * @name: lock_addresses()
+     * @brief: lock the stripes of several addresses without deadlock
+     * @param addresses: pointers to the protected objects
+     * @return: Guard, releases the stripes when destroyed
+     */
+    template <typename... Pointers>
+    Guard<sizeof...(Pointers)> lock_addresses(const Pointers*... addresses)
+    {
+        return Guard<sizeof...(Pointers)>(*this, {get_stripe_of_address(addresses)...});
+    }
+
+}; // class StripedLock
+
+#endif // STRIPEDLOCK_HPP
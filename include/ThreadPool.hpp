@@ -0,0 +1,259 @@
+/**
+ * @file    : ThreadPool.hpp
+ * @brief   : Header file of work-stealing thread pool and task groups
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef THREADPOOL_HPP
+#define THREADPOOL_HPP
+
+#include <thread>       //< allow multi-threading programming
+#include <atomic>       //< allow atomic variables to protect compiler optimization
+#include <cstdint>      //< for uint32_t and uint64_t
+#include <deque>        //< for the injection queue
+#include <exception>    //< for std::exception_ptr
+#include <functional>   //< for std::function
+#include <memory>       //< for std::unique_ptr
+#include <utility>      //< for std::forward
+#include <vector>       //< for the workers
+#include "SpinLock.hpp"
+#include "Futex.hpp"
+#include "WorkStealingDeque.hpp"
+#include "concurrency_utils.hpp"
+
+class ThreadPool;
+
+/**
+ * @name: TaskGroup
+ * @brief: set of tasks of a ThreadPool which can be waited for, e.g. the
+ * children of a recursive task. Waiting inside a worker executes other tasks
+ * meanwhile, so nested groups never block the pool.
+ */
+class TaskGroup
+{
+private:
+    friend class ThreadPool;
+
+    ThreadPool& pool_;                                          //< pool executing the tasks
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> pending_;   //< unfinished tasks, futex word of wait()
+    SpinLock exception_lock_;                                   //< protects exception_
+    std::exception_ptr exception_;                              //< first exception of a task
+
+public:
+
+    /**
+     * @name: TaskGroup()
+     * @brief: Constructor
+     * @param pool: pool executing the tasks
+     */
+    explicit TaskGroup(ThreadPool& pool);
+
+    /**
+     * @name: TaskGroup()
+     * @brief: Copy Constructor is deleted, tasks refer to the group
+     */
+    TaskGroup(const TaskGroup& taskGroup)=delete;
+
+    /**
+     * @name: ~TaskGroup()
+     * @brief: Destructor, waits for the remaining tasks and drops their exceptions
+     */
+    ~TaskGroup();
+
+    /**
+     * @name: run()
+     * @brief: schedule a task of the group
+     * @param function: callable without arguments
+     */
+    template <typename Function>
+    void run(Function&& function);
+
+    /**
+     * @name: wait()
+     * @brief: execute tasks until all tasks of the group finished, rethrows the
+     * first exception of a task
+     */
+    void wait();
+
+}; // class TaskGroup
+
+/**
+ * @name: ThreadPool
+ * @brief: work-stealing thread pool. Every worker owns a WorkStealingDeque, tasks
+ * spawned by a worker go to its own deque and are popped newest first, which
+ * keeps nested parallelism depth-first and cache friendly. Idle workers steal
+ * the oldest tasks of a random victim, tasks from other threads go through an
+ * injection queue. Workers which found nothing for a while park on a futex
+ * eventcount: they announce themselves in num_sleeping_, re-check for work and
+ * sleep on epoch_, spawners bump epoch_ and wake one only if somebody sleeps.
+ */
+class ThreadPool
+{
+private:
+    friend class TaskGroup;
+
+    /**
+     * @brief: type-erased task
+     */
+    struct Task{
+        std::function<void()> function;    //< work
+        TaskGroup* group;                   //< group of the task or nullptr
+    };
+
+    /**
+     * @brief: worker thread with its deque
+     */
+    struct alignas(CACHE_LINE_SIZE) Worker{
+        WorkStealingDeque<Task*> deque;     //< tasks spawned by this worker
+        std::thread thread;                 //< worker thread
+    };
+
+    // rounds over all victims an idle worker tries before it parks
+    static const unsigned int steal_rounds_before_park_ = 64;
+
+    std::vector<std::unique_ptr<Worker>> workers_;              //< workers
+    SpinLock injection_lock_;                                   //< protects injection_
+    std::deque<Task*> injection_;                               //< tasks from outside the pool
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> injection_size_; //< size of injection_, read without lock
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> pending_;    //< unfinished tasks, futex word of wait()
+    alignas(CACHE_LINE_SIZE) std::atomic<uint32_t> epoch_;      //< eventcount, futex word of parked workers
+    std::atomic<uint32_t> num_sleeping_;                        //< parked or parking workers
+    std::atomic<bool> stop_;                                    //< workers leave when idle
+    SpinLock exception_lock_;                                   //< protects exception_
+    std::exception_ptr exception_;                              //< first exception of a task without group
+
+    /**
+     * @name: spawn()
+     * @brief: schedule a task, on the own deque of a worker or the injection queue
+     * @param function: work of the task
+     * @param group: group of the task or nullptr
+     */
+    void spawn(std::function<void()> function, TaskGroup* group);
+
+    /**
+     * @name: get_current_worker()
+     * @brief: return the worker of the calling thread
+     * @return: Worker*, nullptr if the caller is no worker of this pool
+     */
+    Worker* get_current_worker() const;
+
+    /**
+     * @name: find_task()
+     * @brief: pop the own deque, then the injection queue, then steal
+     * @param worker: worker of the caller or nullptr
+     * @return: Task*, task owned by the caller or nullptr if none was found
+     */
+    Task* find_task(Worker* worker);
+
+    /**
+     * @name: has_work()
+     * @brief: return if any queue holds tasks, only a snapshot
+     * @return: boolean, true if a task might be found
+     */
+    bool has_work() const;
+
+    /**
+     * @name: execute()
+     * @brief: run a task, record its exception and signal completion
+     * @param task: task owned by the caller, deleted afterwards
+     */
+    void execute(Task* task);
+
+    /**
+     * @name: notify()
+     * @brief: wake a parked worker after new work was published
+     */
+    void notify();
+
+    /**
+     * @name: help_until_done()
+     * @brief: execute tasks until the counter reaches zero, sleep if none is found
+     * @param counter: number of unfinished tasks
+     */
+    void help_until_done(std::atomic<uint32_t>& counter);
+
+    /**
+     * @name: run_worker()
+     * @brief: main loop of a worker thread
+     * @param index: index of the worker
+     */
+    void run_worker(unsigned int index);
+
+public:
+
+    /**
+     * @name: ThreadPool()
+     * @brief: Constructor, starts the workers
+     * @param num_threads: number of workers, at least one
+     */
+    explicit ThreadPool(unsigned int num_threads = std::thread::hardware_concurrency());
+
+    /**
+     * @name: ThreadPool()
+     * @brief: Copy Constructor is deleted, workers refer to the pool
+     */
+    ThreadPool(const ThreadPool& threadPool)=delete;
+
+    /**
+     * @name: ~ThreadPool()
+     * @brief: Destructor, finishes all tasks and joins the workers
+     */
+    ~ThreadPool();
+
+    /**
+     * @name: submit()
+     * @brief: schedule a task
+     * @param function: callable without arguments
+     */
+    template <typename Function>
+    void submit(Function&& function)
+    {
+        spawn(std::function<void()>(std::forward<Function>(function)), nullptr);
+    }
+
+    /**
+     * @name: wait()
+     * @brief: execute tasks until all submitted tasks finished, rethrows the
+     * first exception of a task without group
+     */
+    void wait();
+
+    /**
+     * @name: get_num_threads()
+     * @brief: return the number of workers
+     * @return: unsigned int, number of workers
+     */
+    unsigned int get_num_threads() const;
+
+    /**
+     * @name: get_worker_index()
+     * @brief: return the index of the calling worker
+     * @return: int, index in [0, get_num_threads()) or -1 if the caller is no worker of this pool
+     */
+    int get_worker_index() const;
+
+    /**
+     * @name: get_global()
+     * @brief: return the pool shared by the parallel algorithms, one worker per
+     * hardware thread, started on first use
+     * @return: ThreadPool&, shared pool
+     */
+    static ThreadPool& get_global();
+
+}; // class ThreadPool
+
+/**
+ * @name: run()
+ * @brief: schedule a task of the group
+ * @param function: callable without arguments
+ */
+template <typename Function>
+void TaskGroup::run(Function&& function)
+{
+    pool_.spawn(std::function<void()>(std::forward<Function>(function)), this);
+}
+
+#endif // THREADPOOL_HPP
@@ -0,0 +1,99 @@
+/**
+ * @file    : ThreadRecords.hpp
+ * @brief   : Header file of per-thread records of memory reclamation domains
+ * @author  : David Blickenstorfer
+ *
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef THREADRECORDS_HPP
+#define THREADRECORDS_HPP
+
+#include <cstdint>  //< for uint64_t
+#include <vector>   //< for std::vector of the entries
+
+/**
+ * @name: ThreadRecords
+ * @brief: records of the calling thread in all reclamation domains it used
+ * (EpochDomain, HazardDomain). Domains register a unique id while alive, the
+ * records of a thread are handed back to their living domains when the thread
+ * exits, records of destroyed domains are forgotten.
+ */
+class ThreadRecords
+{
+public:
+    // claim or create the record of the calling thread, registry mutex held
+    using Claim = void* (*)(void* domain);
+    // hand back the record of an exiting thread, registry mutex held
+    using Release = void (*)(void* domain, void* record);
+
+private:
+    /**
+     * @brief: record of the thread in one domain
+     */
+    struct Entry{
+        void* domain;       //< domain of the record
+        uint64_t id;        //< id of the domain, the address may be reused
+        void* record;       //< owned record
+        Release release;    //< hands the record back to the domain
+    };
+
+    std::vector<Entry> entries_;    //< records of the thread
+
+    /**
+     * @name: get_local()
+     * @brief: return the records of the calling thread
+     */
+    static ThreadRecords& get_local();
+
+public:
+
+    /**
+     * @name: ThreadRecords()
+     * @brief: Default Constructor
+     */
+    ThreadRecords()=default;
+
+    /**
+     * @name: ThreadRecords()
+     * @brief: Copy Constructor is deleted, the records are owned by one thread
+     */
+    ThreadRecords(const ThreadRecords& threadRecords)=delete;
+
+    /**
+     * @name: ~ThreadRecords()
+     * @brief: Destructor, release the records of living domains
+     */
+    ~ThreadRecords();
+
+    /**
+     * @name: add_domain()
+     * @brief: register a new domain
+     * @return: uint64_t, unique id of the domain
+     */
+    static uint64_t add_domain();
+
+    /**
+     * @name: remove_domain()
+     * @brief: unregister a domain, waits for exiting threads releasing a
+     * record, afterwards the domain may free its records
+     * @param id: id of the domain
+     */
+    static void remove_domain(uint64_t id);
+
+    /**
+     * @name: get()
+     * @brief: return the record of the calling thread in a domain, claim it
+     * on first use
+     * @param domain: pointer to the domain
+     * @param id: id of the domain
+     * @param claim: claims a record of the domain for the calling thread
+     * @param release: hands the record back when the thread exits
+     * @return: void*, record owned by the calling thread
+     */
+    static void* get(void* domain, uint64_t id, Claim claim, Release release);
+
+}; // class ThreadRecords
+
+#endif // THREADRECORDS_HPP
@@ -0,0 +1,210 @@
+/**
+ * @file    : WorkStealingDeque.hpp
+ * @brief   : Header file of lock-free Chase-Lev work-stealing deque
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef WORKSTEALINGDEQUE_HPP
+#define WORKSTEALINGDEQUE_HPP
+
+#include <atomic>       //< allow atomic variables to protect compiler optimization
+#include <cstdint>      //< for int64_t
+#include <memory>       //< for std::unique_ptr
+#include <vector>       //< for the retired arrays
+#include <type_traits>  //< for std::is_trivially_copyable
+#include "concurrency_utils.hpp"
+
+/**
+ * @name: WorkStealingDeque
+ * @brief: growable lock-free deque of Chase and Lev with the memory orders of
+ * Le et al. The owner thread pushes and pops at the bottom like a stack, any
+ * other thread steals from the top. Owner operations only synchronize with
+ * thieves when a single element is left. Outgrown arrays are retired, not
+ * freed, since a thief might still read from them, and are released by the
+ * destructor.
+ */
+template <typename T>
+class WorkStealingDeque
+{
+    static_assert(std::is_trivially_copyable<T>::value, "WorkStealingDeque<T> stores T in atomics, e.g. pointers");
+
+private:
+    /**
+     * @brief: circular array of a power-of-two capacity
+     */
+    struct Array{
+        int64_t mask;                           //< capacity - 1
+        std::unique_ptr<std::atomic<T>[]> slots; //< elements
+
+        explicit Array(int64_t capacity) : mask(capacity - 1), slots(new std::atomic<T>[capacity]) {}
+        int64_t get_capacity() const { return mask + 1; }
+        T get(int64_t index) const { return slots[index & mask].load(std::memory_order_relaxed); }
+        void put(int64_t index, T value) { slots[index & mask].store(value, std::memory_order_relaxed); }
+    };
+
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> top_;       //< next element to steal
+    alignas(CACHE_LINE_SIZE) std::atomic<int64_t> bottom_;    //< next free position of the owner
+    std::atomic<Array*> array_;                               //< current array
+    std::vector<std::unique_ptr<Array>> arrays_;              //< current and retired arrays, owner only
+
+    /**
+     * @name: grow()
+     * @brief: copy the elements into an array of twice the capacity, owner only
+     * @param array: current array
+     * @param top: current top
+     * @param bottom: current bottom
+     * @return: Array*, new array
+     */
+    Array* grow(Array* array, int64_t top, int64_t bottom)
+    {
+        arrays_.emplace_back(new Array(2 * array->get_capacity()));
+        Array* new_array = arrays_.back().get();
+        for(int64_t i = top; i < bottom; i++){
+            new_array->put(i, array->get(i));
+        }
+        array_.store(new_array, std::memory_order_release);
+        return new_array;
+    }
+
+public:
+
+    /**
+     * @name: WorkStealingDeque()
+     * @brief: Constructor
+     * @param capacity: initial number of slots, rounded up to a power of two
+     */
+    explicit WorkStealingDeque(int64_t capacity = 256)
+    {
+        int64_t rounded = 1;
+        while(rounded < capacity){
+            rounded <<= 1;
+        }
+        arrays_.emplace_back(new Array(rounded));
+        array_.store(arrays_.back().get(), std::memory_order_relaxed);
+        top_.store(0, std::memory_order_relaxed);
+        bottom_.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * @name: WorkStealingDeque()
+     * @brief: Copy Constructor is deleted, thieves refer to the arrays
+     */
+    WorkStealingDeque(const WorkStealingDeque& workStealingDeque)=delete;
+
+    /**
+     * @name: ~WorkStealingDeque()
+     * @brief: Default Destructor, releases all arrays
+     */
+    ~WorkStealingDeque()=default;
+
+    /**
+     * @name: push()
+     * @brief: add an element at the bottom, owner only, grows if full
+     * @param value: element to add
+     */
+    void push(T value)
+    {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed);
+        const int64_t top = top_.load(std::memory_order_acquire);
+        Array* array = array_.load(std::memory_order_relaxed);
+        if(bottom - top > array->mask){
+            array = grow(array, top, bottom);
+        }
+        array->put(bottom, value);
+        // release: thieves reading the new bottom see the element
+        std::atomic_thread_fence(std::memory_order_release);
+        bottom_.store(bottom + 1, std::memory_order_relaxed);
+    }
+
+    /**
+     * @name: pop()
+     * @brief: remove the element at the bottom (newest), owner only
+     * @param value: output, overwritten only on success
+     * @return: boolean, false if the deque is empty or a thief took the last element
+     */
+    bool pop(T& value)
+    {
+        const int64_t bottom = bottom_.load(std::memory_order_relaxed) - 1;
+        Array* array = array_.load(std::memory_order_relaxed);
+        bottom_.store(bottom, std::memory_order_relaxed);
+        // the reservation of the bottom element must be visible before top is read
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        int64_t top = top_.load(std::memory_order_relaxed);
+        if(top > bottom){
+            // empty, restore bottom
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+        value = array->get(bottom);
+        if(top == bottom){
+            // last element, race against the thieves for it
+            const bool success = top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst,
+                                                             std::memory_order_relaxed);
+            bottom_.store(bottom + 1, std::memory_order_relaxed);
+            return success;
+        }
+        return true;
+    }
+
+    /**
+     * @name: steal()
+     * @brief: remove the element at the top (oldest), any thread
+     * @param value: output, overwritten only on success
+     * @return: boolean, false if the deque is empty or another thread won the race
+     */
+    bool steal(T& value)
+    {
+        int64_t top = top_.load(std::memory_order_acquire);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const int64_t bottom = bottom_.load(std::memory_order_acquire);
+        if(top >= bottom){
+            return false;
+        }
+        // acquire: the elements copied by grow() are visible
+        Array* array = array_.load(std::memory_order_acquire);
+        const T element = array->get(top);
+        if(!top_.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)){
+            return false;
+        }
+        value = element;
+        return true;
+    }
+
+    /**
+     * @name: size()
+     * @brief: return the number of elements, only a snapshot under concurrency
+     * @return: int64_t, number of elements
+     */
+    int64_t size() const
+    {
+        const int64_t bottom = bottom_.load(std::memory_order_acquire);
+        const int64_t top = top_.load(std::memory_order_acquire);
+        return (bottom > top) ? bottom - top : 0;
+    }
+
+    /**
+     * @name: empty()
+     * @brief: return if the deque is empty, only a snapshot under concurrency
+     * @return: boolean, true if the deque is empty
+     */
+    bool empty() const
+    {
+        return size() == 0;
+    }
+
+    /**
+     * @name: get_capacity()
+     * @brief: return the number of slots of the current array, owner only
+     * @return: int64_t, power of two
+     */
+    int64_t get_capacity() const
+    {
+        return array_.load(std::memory_order_relaxed)->get_capacity();
+    }
+
+}; // class WorkStealingDeque
+
+#endif // WORKSTEALINGDEQUE_HPP
@@ -0,0 +1,133 @@
+/**
+ * @file    : concurrency_utils.hpp
+ * @brief   : Header file of small helpers shared by the concurrency tools
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026 (cache line size and cpu_relax)
+ * @date 18/10/2026 (dense thread index)
+ * @date 19/10/2026 (object registry)
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#ifndef CONCURRENCY_UTILS_HPP
+#define CONCURRENCY_UTILS_HPP
+
+#include <cstddef>    //< for std::size_t
+#include <new>        //< for std::hardware_destructive_interference_size
+#include <atomic>     //< for the thread index counter
+#include <mutex>      //< for std::mutex of the object registry
+#include <vector>     //< for std::vector of the object registry
+#include <algorithm>  //< for std::find
+
+/**
+ * @name: CACHE_LINE_SIZE
+ * @brief: minimal distance in bytes between two objects to avoid false sharing
+ */
+#ifdef __cpp_lib_hardware_interference_size
+// the value only depends on the target, the ABI warning of GCC does not apply
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Winterference-size"
+#endif
+constexpr std::size_t CACHE_LINE_SIZE = std::hardware_destructive_interference_size;
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+#else
+constexpr std::size_t CACHE_LINE_SIZE = 64;
+#endif
+
+/**
+ * @name: cpu_relax()
+ * @brief: hint the CPU that the calling thread is busy-waiting, this reduces
+ * the power consumption and the penalty when leaving the spin loop
+ */
+inline void cpu_relax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    __builtin_ia32_pause();
+#elif defined(__aarch64__) || defined(__arm__)
+    asm volatile("yield" ::: "memory");
+#else
+    asm volatile("" ::: "memory");
+#endif
+}
+
+/**
+ * @name: get_thread_index()
+ * @brief: return a small index of the calling thread, assigned in order of the
+ * first call and never reused, used to pick per-thread slots
+ * @return: std::size_t, index of the calling thread
+ */
+inline std::size_t get_thread_index()
+{
+    static std::atomic<std::size_t> next_index(0);
+    thread_local const std::size_t index = next_index.fetch_add(1, std::memory_order_relaxed);
+    return index;
+}
+
+/**
+ * @name: ObjectRegistry
+ * @brief: mutex protected list of living objects (ids or pointers), used for
+ * process-wide registries like all reclamation domains or all lock statistics
+ */
+template <typename T>
+class ObjectRegistry
+{
+private:
+    std::mutex mutex_;          //< protects objects_
+    std::vector<T> objects_;    //< living objects
+
+public:
+
+    /**
+     * @name: add()
+     * @brief: register an object, locks the registry
+     * @param object: registered object
+     */
+    void add(const T& object)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        objects_.push_back(object);
+    }
+
+    /**
+     * @name: remove()
+     * @brief: unregister an object, locks the registry, so a holder of
+     * get_mutex() never sees the object disappear
+     * @param object: registered object
+     */
+    void remove(const T& object)
+    {
+        std::lock_guard<std::mutex> guard(mutex_);
+        objects_.erase(std::find(objects_.begin(), objects_.end(), object));
+    }
+
+    /**
+     * @name: contains()
+     * @brief: return if an object is registered, get_mutex() must be held
+     * @param object: searched object
+     * @return: boolean, true if the object is registered
+     */
+    bool contains(const T& object) const
+    {
+        return std::find(objects_.begin(), objects_.end(), object) != objects_.end();
+    }
+
+    /**
+     * @name: get_objects()
+     * @brief: return all registered objects, get_mutex() must be held
+     * @return: const std::vector<T>&, registered objects
+     */
+    const std::vector<T>& get_objects() const { return objects_; }
+
+    /**
+     * @name: get_mutex()
+     * @brief: return the mutex of the registry
+     * @return: std::mutex&, mutex protecting the registered objects
+     */
+    std::mutex& get_mutex() { return mutex_; }
+
+}; // class ObjectRegistry
+
+#endif // CONCURRENCY_UTILS_HPP
@@ -0,0 +1,208 @@
+/**
+ * @file    : AdaptiveLock.cpp
+ * @brief   : Cpp file of Lock switching between TTAS and queue mode
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#include "../include/AdaptiveLock.hpp"
+
+// number of busy-wait iterations before yielding the CPU
+static const unsigned int spins_before_yield = 128;
+
+/**
+ * @name: AdaptiveLock()
+ * @brief: Default Constructor
+ * @param window: number of acquisitions per contention window
+ */
+AdaptiveLock::AdaptiveLock(unsigned int window)
+{
+    locked_ = false;
+    tail_ = nullptr;
+    queue_mode_ = false;
+    window_ = (window > 0) ? window : 1;
+    window_acquisitions_ = 0;
+    window_contended_ = 0;
+    high_windows_ = 0;
+    low_windows_ = 0;
+    mode_switches_ = 0;
+}
+
+/**
+ * @name: spin_on_word()
+ * @brief: TTAS spinning until the lock word is taken
+ */
+void AdaptiveLock::spin_on_word()
+{
+    while(locked_.exchange(true, std::memory_order_acquire)){
+        unsigned int spins = 0;
+        while(locked_.load(std::memory_order_relaxed)){
+            if(++spins < spins_before_yield){
+                cpu_relax();
+            }else{
+                // reduce CPU contention
+                std::this_thread::yield();
+                spins = 0;
+            }
+        }
+    }
+}
+
+/**
+ * @name: acquire_queued()
+ * @brief: wait in the MCS queue, then spin on the lock word as queue head
+ */
+void AdaptiveLock::acquire_queued()
+{
+    QueueNode node;
+    QueueNode* predecessor = tail_.exchange(&node, std::memory_order_acq_rel);
+    if(predecessor != nullptr){
+        // wait on the own cache line until the predecessor hands over the queue head
+        predecessor->next.store(&node, std::memory_order_release);
+        unsigned int spins = 0;
+        while(node.waiting.load(std::memory_order_acquire)){
+            if(++spins < spins_before_yield){
+                cpu_relax();
+            }else{
+                std::this_thread::yield();
+                spins = 0;
+            }
+        }
+    }
+
+    // only the queue head competes for the lock word
+    spin_on_word();
+
+    // leave the queue, the node must not be referenced after returning
+    QueueNode* successor = node.next.load(std::memory_order_acquire);
+    if(successor == nullptr){
+        QueueNode* expected = &node;
+        if(tail_.compare_exchange_strong(expected, nullptr, std::memory_order_acq_rel)){
+            return;
+        }
+        // a successor swapped the tail but has not linked itself yet
+        while((successor = node.next.load(std::memory_order_acquire)) == nullptr){
+            cpu_relax();
+        }
+    }
+    successor->waiting.store(false, std::memory_order_release);
+}
+
+/**
+ * @name: record()
+ * @brief: update the contention statistics, called by the owner
+ * @param contended: boolean, true if the acquisition had to wait
+ */
+void AdaptiveLock::record(bool contended)
+{
+    window_acquisitions_++;
+    window_contended_ += contended;
+    if(window_acquisitions_ < window_){
+        return;
+    }
+
+    // evaluate the window with hysteresis between the two modes
+    const bool high = 2 * window_contended_ > window_acquisitions_;
+    const bool low = 16 * window_contended_ < window_acquisitions_;
+    high_windows_ = high ? high_windows_ + 1 : 0;
+    low_windows_ = low ? low_windows_ + 1 : 0;
+    window_acquisitions_ = 0;
+    window_contended_ = 0;
+
+    const bool queue_mode = queue_mode_.load(std::memory_order_relaxed);
+    if(!queue_mode && high_windows_ >= windows_to_queue_){
+        queue_mode_.store(true, std::memory_order_relaxed);
+        mode_switches_++;
+    }else if(queue_mode && low_windows_ >= windows_to_spin_){
+        queue_mode_.store(false, std::memory_order_relaxed);
+        mode_switches_++;
+    }
+}
+
+/**
+ * @name: acquire()
+ * @brief: lock the adaptive lock before entering critical region
+ */
+void AdaptiveLock::acquire()
+{
+    // fast path: uncontended lock
+    if(!locked_.load(std::memory_order_relaxed) && !locked_.exchange(true, std::memory_order_acquire)){
+        record(false);
+        return;
+    }
+    if(queue_mode_.load(std::memory_order_relaxed)){
+        acquire_queued();
+    }else{
+        spin_on_word();
+    }
+    record(true);
+}
+
+/**
+ * @name: release()
+ * @brief: unlock the adaptive lock before leaving critical region
+ */
+void AdaptiveLock::release()
+{
+    locked_.store(false, std::memory_order_release);
+}
+
+/**
+ * @name: try_acquire()
+ * @brief: try to lock the adaptive lock once without waiting
+ * @return: boolean, true if the lock was acquired
+ */
+bool AdaptiveLock::try_acquire()
+{
+    return !locked_.load(std::memory_order_relaxed) && !locked_.exchange(true, std::memory_order_acquire);
+}
+
+/**
+ * @name: lock()
+ * @brief: Lockable interface, same as acquire()
+ */
+void AdaptiveLock::lock()
+{
+    acquire();
+}
+
+/**
+ * @name: unlock()
+ * @brief: Lockable interface, same as release()
+ */
+void AdaptiveLock::unlock()
+{
+    release();
+}
+
+/**
+ * @name: try_lock()
+ * @brief: Lockable interface, same as try_acquire()
+ * @return: boolean, true if the lock was acquired
+ */
+bool AdaptiveLock::try_lock()
+{
+    return try_acquire();
+}
+
+/**
+ * @name: is_queue_mode()
+ * @brief: return the mode of new waiters
+ * @return: boolean, true if waiters line up in the MCS queue
+ */
+bool AdaptiveLock::is_queue_mode() const
+{
+    return queue_mode_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @name: get_mode_switches()
+ * @brief: return the number of mode switches, read by the owner
+ * @return: unsigned long, number of mode switches
+ */
+unsigned long AdaptiveLock::get_mode_switches() const
+{
+    return mode_switches_;
+}
@@ -8,6 +8,7 @@
  */
 
 #include "../include/AtomicLock.hpp"
+#include "../include/AtomicPrimitives.hpp"
 
 /**
  * @name: AtomicLock()
@@ -25,7 +26,8 @@ AtomicLock::AtomicLock()
  */
 void AtomicLock::acquire()
 {
-    while(TAS(&locked_)){
+    // acquire ordering is sufficient, TAS() would be a full barrier
+    while(atomic_tas(&locked_, std::memory_order_acquire)){
         // reduce CPU contention 
         std::this_thread::yield();
     }
@@ -37,6 +39,44 @@ void AtomicLock::acquire()
  */
 void AtomicLock::release()
 {
-    locked_ = false;
+    // store false with release semantics, keeps the critical region inside
+    atomic_clear(&locked_, std::memory_order_release);
+}
+
+/**
+ * @name: try_acquire()
+ * @brief: try to lock the TAS lock once without waiting
+ * @return: boolean, true if the lock was acquired
+ */
+bool AtomicLock::try_acquire()
+{
+    return !atomic_tas(&locked_, std::memory_order_acquire);
+}
+
+/**
+ * @name: lock()
+ * @brief: Lockable interface, same as acquire()
+ */
+void AtomicLock::lock()
+{
+    acquire();
+}
+
+/**
+ * @name: unlock()
+ * @brief: Lockable interface, same as release()
+ */
+void AtomicLock::unlock()
+{
+    release();
 }
 
+/**
+ * @name: try_lock()
+ * @brief: Lockable interface, same as try_acquire()
+ * @return: boolean, true if the lock was acquired
+ */
+bool AtomicLock::try_lock()
+{
+    return try_acquire();
+}
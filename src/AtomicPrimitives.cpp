@@ -0,0 +1,67 @@
+/**
+ * @file    : AtomicPrimitives.cpp
+ * @brief   : Cpp file of double-width compare-and-swap detection and emulation
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#include "../include/AtomicPrimitives.hpp"
+#include "../include/SpinLock.hpp"
+#include "../include/concurrency_utils.hpp"
+#include <cstdint>  //< for uintptr_t
+
+#if defined(__x86_64__)
+#include <cpuid.h>  //< for __get_cpuid
+#endif
+
+// number of locks of the DWCAS emulation
+static const unsigned int num_emulation_locks = 64;
+
+/**
+ * @name: detect_native_dwcas()
+ * @brief: query the CPU for a lock-free 16 byte CAS, called once for native_dwcas
+ * @return: boolean, true if dwcas() is lock-free
+ */
+bool detect_native_dwcas()
+{
+#if defined(__x86_64__)
+    unsigned int eax, ebx, ecx, edx;
+    if(__get_cpuid(1, &eax, &ebx, &ecx, &edx) == 0){
+        return false;
+    }
+    return (ecx & bit_CMPXCHG16B) != 0;
+#elif defined(__GCC_HAVE_SYNC_COMPARE_AND_SWAP_16)
+    return true;
+#else
+    return false;
+#endif
+}
+
+/**
+ * @name: dwcas_locked()
+ * @brief: DWCAS emulated with a striped lock table, used without native support
+ * @param value: pointer to the 16 byte aligned memory
+ * @param expected: reference value, overwritten with the current value on failure
+ * @param new_val: stored value on success
+ * @return: boolean, true if the memory was modified
+ */
+bool dwcas_locked(DoubleWord* value, DoubleWord& expected, DoubleWord new_val)
+{
+    struct alignas(CACHE_LINE_SIZE) PaddedLock{
+        SpinLock lock;
+    };
+    static PaddedLock locks[num_emulation_locks];
+
+    SpinLock& lock = locks[(reinterpret_cast<uintptr_t>(value) >> 4) % num_emulation_locks].lock;
+    lock.acquire();
+    const bool success = (*value == expected);
+    if(success){
+        *value = new_val;
+    }else{
+        expected = *value;
+    }
+    lock.release();
+    return success;
+}
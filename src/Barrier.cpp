@@ -0,0 +1,219 @@
+/**
+ * @file    : Barrier.cpp
+ * @brief   : Cpp file of scalable barriers: centralized sense-reversing,
+ * dissemination and tournament barrier
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#include "../include/Barrier.hpp"
+#include <thread>       //< for std::this_thread::yield
+#include <algorithm>    //< for std::max
+
+// pause steps of the backoff before a waiting thread yields the CPU
+static const unsigned int max_backoff = 64;
+
+/**
+ * @name: spin_until()
+ * @brief: wait with exponential pause backoff until the condition holds,
+ * yields the CPU once the backoff is saturated
+ * @param condition: callable returning true once the wait is over
+ */
+template <typename Condition>
+static void spin_until(Condition&& condition)
+{
+    unsigned int length = 1;
+    while(!condition()){
+        if(length < max_backoff){
+            for(unsigned int i = 0; i < length; i++){
+                cpu_relax();
+            }
+            length *= 2;
+        }else{
+            std::this_thread::yield();
+        }
+    }
+}
+
+/**
+ * @name: reached()
+ * @brief: return if an episode flag reached an episode, robust to wrap-around
+ * @param flag: episode flag
+ * @param episode: awaited episode
+ * @return: boolean, true if the flag is at or beyond the episode
+ */
+static bool reached(const std::atomic<uint32_t>& flag, uint32_t episode)
+{
+    return int32_t(flag.load(std::memory_order_acquire) - episode) >= 0;
+}
+
+/**
+ * @name: get_num_rounds()
+ * @brief: return ceil(log2(num_threads))
+ * @param num_threads: number of threads
+ * @return: unsigned int, number of rounds
+ */
+static unsigned int get_num_rounds(unsigned int num_threads)
+{
+    unsigned int num_rounds = 0;
+    while((1ull << num_rounds) < num_threads){
+        num_rounds++;
+    }
+    return num_rounds;
+}
+
+/**
+ * @name: SenseBarrier()
+ * @brief: Constructor
+ * @param num_threads: number of participating threads, at least one
+ */
+SenseBarrier::SenseBarrier(unsigned int num_threads)
+{
+    num_threads_ = std::max(1u, num_threads);
+    count_ = num_threads_;
+    sense_ = false;
+    local_senses_.reset(new LocalSense[num_threads_]);
+    for(unsigned int i = 0; i < num_threads_; i++){
+        local_senses_[i].sense = false;
+    }
+}
+
+/**
+ * @name: arrive_and_wait()
+ * @brief: block until all threads arrived
+ * @param thread_id: id of the calling thread in [0, num_threads)
+ */
+void SenseBarrier::arrive_and_wait(unsigned int thread_id)
+{
+    const bool sense = !local_senses_[thread_id].sense;
+    local_senses_[thread_id].sense = sense;
+    // acq_rel: the last thread sees the writes of all others before releasing them
+    if(count_.fetch_sub(1, std::memory_order_acq_rel) == 1){
+        count_.store(num_threads_, std::memory_order_relaxed);
+        sense_.store(sense, std::memory_order_release);
+    }else{
+        spin_until([&](){ return sense_.load(std::memory_order_acquire) == sense; });
+    }
+}
+
+/**
+ * @name: get_num_threads()
+ * @brief: return the number of participating threads
+ * @return: unsigned int, number of threads
+ */
+unsigned int SenseBarrier::get_num_threads() const
+{
+    return num_threads_;
+}
+
+/**
+ * @name: DisseminationBarrier()
+ * @brief: Constructor
+ * @param num_threads: number of participating threads, at least one
+ */
+DisseminationBarrier::DisseminationBarrier(unsigned int num_threads)
+{
+    num_threads_ = std::max(1u, num_threads);
+    num_rounds_ = get_num_rounds(num_threads_);
+    nodes_.reset(new Node[num_threads_]);
+    for(unsigned int i = 0; i < num_threads_; i++){
+        for(unsigned int round = 0; round < max_rounds_; round++){
+            nodes_[i].flags[round].store(0, std::memory_order_relaxed);
+        }
+        nodes_[i].episode = 0;
+    }
+}
+
+/**
+ * @name: arrive_and_wait()
+ * @brief: block until all threads arrived
+ * @param thread_id: id of the calling thread in [0, num_threads)
+ */
+void DisseminationBarrier::arrive_and_wait(unsigned int thread_id)
+{
+    Node& node = nodes_[thread_id];
+    const uint32_t episode = ++node.episode;
+    for(unsigned int round = 0; round < num_rounds_; round++){
+        const unsigned int partner = (thread_id + (1u << round)) % num_threads_;
+        // release: everything this thread knows is passed on to the partner
+        nodes_[partner].flags[round].store(episode, std::memory_order_release);
+        // the signaler can be one episode ahead, but not two
+        spin_until([&](){ return reached(node.flags[round], episode); });
+    }
+}
+
+/**
+ * @name: get_num_threads()
+ * @brief: return the number of participating threads
+ * @return: unsigned int, number of threads
+ */
+unsigned int DisseminationBarrier::get_num_threads() const
+{
+    return num_threads_;
+}
+
+/**
+ * @name: TournamentBarrier()
+ * @brief: Constructor
+ * @param num_threads: number of participating threads, at least one
+ */
+TournamentBarrier::TournamentBarrier(unsigned int num_threads)
+{
+    num_threads_ = std::max(1u, num_threads);
+    num_rounds_ = get_num_rounds(num_threads_);
+    nodes_.reset(new Node[num_threads_]);
+    for(unsigned int i = 0; i < num_threads_; i++){
+        for(unsigned int round = 0; round < max_rounds_; round++){
+            nodes_[i].arrivals[round].store(0, std::memory_order_relaxed);
+        }
+        nodes_[i].wakeup.store(0, std::memory_order_relaxed);
+        nodes_[i].episode = 0;
+    }
+}
+
+/**
+ * @name: arrive_and_wait()
+ * @brief: block until all threads arrived
+ * @param thread_id: id of the calling thread in [0, num_threads)
+ */
+void TournamentBarrier::arrive_and_wait(unsigned int thread_id)
+{
+    Node& node = nodes_[thread_id];
+    const uint32_t episode = ++node.episode;
+
+    // arrival: win rounds until losing, the champion wins all
+    unsigned int round = 0;
+    for(; round < num_rounds_; round++){
+        const unsigned int distance = 1u << round;
+        if(thread_id & distance){
+            // loser, the winner is thread_id - distance
+            nodes_[thread_id - distance].arrivals[round].store(episode, std::memory_order_release);
+            spin_until([&](){ return reached(node.wakeup, episode); });
+            break;
+        }
+        if(thread_id + distance < num_threads_){
+            // winner with an opponent, otherwise a bye
+            spin_until([&](){ return reached(node.arrivals[round], episode); });
+        }
+    }
+
+    // wake-up: wake the opponents beaten in the rounds before the lost one
+    while(round-- > 0){
+        const unsigned int loser = thread_id + (1u << round);
+        if(loser < num_threads_){
+            nodes_[loser].wakeup.store(episode, std::memory_order_release);
+        }
+    }
+}
+
+/**
+ * @name: get_num_threads()
+ * @brief: return the number of participating threads
+ * @return: unsigned int, number of threads
+ */
+unsigned int TournamentBarrier::get_num_threads() const
+{
+    return num_threads_;
+}
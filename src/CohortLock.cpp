@@ -0,0 +1,164 @@
+/**
+ * @file    : CohortLock.cpp
+ * @brief   : Cpp file of NUMA-aware hierarchical cohort lock
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#include "../include/CohortLock.hpp"
+
+// number of busy-wait iterations before yielding the CPU
+static const unsigned int spins_before_yield = 128;
+
+/**
+ * @name: spin_acquire()
+ * @brief: TTAS lock, spin on a local copy and only swap if the lock looks free
+ * @param locked: lock state, true if locked
+ */
+static void spin_acquire(std::atomic<bool>& locked)
+{
+    while(locked.exchange(true, std::memory_order_acquire)){
+        unsigned int spins = 0;
+        while(locked.load(std::memory_order_relaxed)){
+            if(++spins < spins_before_yield){
+                cpu_relax();
+            }else{
+                // reduce CPU contention
+                std::this_thread::yield();
+                spins = 0;
+            }
+        }
+    }
+}
+
+/**
+ * @name: CohortLock()
+ * @brief: Constructor for the topology of this machine
+ * @param max_batch: maximal number of consecutive handovers within a node
+ */
+CohortLock::CohortLock(unsigned int max_batch)
+    : CohortLock(NumaTopology::get_system(), max_batch)
+{
+}
+
+/**
+ * @name: CohortLock()
+ * @brief: Constructor for a given topology
+ * @param topology: CPU to NUMA node mapping
+ * @param max_batch: maximal number of consecutive handovers within a node
+ */
+CohortLock::CohortLock(const NumaTopology& topology, unsigned int max_batch)
+    : topology_(topology)
+{
+    global_locked_ = false;
+    locals_ = std::make_unique<LocalLock[]>(topology_.get_num_nodes());
+    max_batch_ = max_batch;
+    owner_node_ = 0;
+}
+
+/**
+ * @name: acquire()
+ * @brief: lock the cohort lock before entering critical region
+ */
+void CohortLock::acquire()
+{
+    const unsigned int node = topology_.get_current_node();
+    LocalLock& local = locals_[node];
+
+    // announce the waiter, the owner of the node passes the global lock to it
+    local.waiters.fetch_add(1, std::memory_order_relaxed);
+    spin_acquire(local.locked);
+    local.waiters.fetch_sub(1, std::memory_order_relaxed);
+
+    // the global lock is only taken if it was not passed within the cohort
+    if(!local.owns_global){
+        spin_acquire(global_locked_);
+        local.owns_global = true;
+    }
+    owner_node_ = node;
+}
+
+/**
+ * @name: release()
+ * @brief: unlock the cohort lock before leaving critical region
+ */
+void CohortLock::release()
+{
+    LocalLock& local = locals_[owner_node_];
+
+    if(local.waiters.load(std::memory_order_relaxed) > 0 && local.batch < max_batch_){
+        // keep the global lock within the node
+        local.batch++;
+    }else{
+        // hand the global lock to the other nodes
+        local.batch = 0;
+        local.owns_global = false;
+        global_locked_.store(false, std::memory_order_release);
+    }
+    local.locked.store(false, std::memory_order_release);
+}
+
+/**
+ * @name: get_num_nodes()
+ * @brief: return the number of local locks
+ * @return: unsigned int, number of NUMA nodes
+ */
+unsigned int CohortLock::get_num_nodes() const
+{
+    return topology_.get_num_nodes();
+}
+
+/**
+ * @name: try_acquire()
+ * @brief: try to lock the cohort lock once without waiting
+ * @return: boolean, true if the lock was acquired
+ */
+bool CohortLock::try_acquire()
+{
+    const unsigned int node = topology_.get_current_node();
+    LocalLock& local = locals_[node];
+
+    // timed waiters are not announced, the cohort never waits for them
+    if(local.locked.exchange(true, std::memory_order_acquire)){
+        return false;
+    }
+    if(!local.owns_global){
+        if(global_locked_.exchange(true, std::memory_order_acquire)){
+            local.locked.store(false, std::memory_order_release);
+            return false;
+        }
+        local.owns_global = true;
+    }
+    owner_node_ = node;
+    return true;
+}
+
+/**
+ * @name: lock()
+ * @brief: Lockable interface, same as acquire()
+ */
+void CohortLock::lock()
+{
+    acquire();
+}
+
+/**
+ * @name: unlock()
+ * @brief: Lockable interface, same as release()
+ */
+void CohortLock::unlock()
+{
+    release();
+}
+
+/**
+ * @name: try_lock()
+ * @brief: Lockable interface, same as try_acquire()
+ * @return: boolean, true if the lock was acquired
+ */
+bool CohortLock::try_lock()
+{
+    return try_acquire();
+}
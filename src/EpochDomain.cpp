@@ -0,0 +1,266 @@
+/**
+ * @file    : EpochDomain.cpp
+ * @brief   : Cpp file of epoch-based memory reclamation (EBR) for lock-free
+ * data structures
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#include "../include/EpochDomain.hpp"
+#include "../include/ThreadRecords.hpp"
+
+/**
+ * @name: EpochDomain()
+ * @brief: Constructor
+ * @param retire_batch: number of retired nodes of a thread which triggers a collection
+ */
+EpochDomain::EpochDomain(std::size_t retire_batch)
+{
+    id_ = ThreadRecords::add_domain();
+    retire_batch_ = (retire_batch > 0) ? retire_batch : 1;
+    epoch_.store(0, std::memory_order_relaxed);
+    records_.store(nullptr, std::memory_order_relaxed);
+    num_freed_.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @name: ~EpochDomain()
+ * @brief: Destructor, frees all retired nodes, no guard may be active
+ */
+EpochDomain::~EpochDomain()
+{
+    ThreadRecords::remove_domain(id_);
+    ThreadRecord* record = records_.load(std::memory_order_acquire);
+    while(record != nullptr){
+        ThreadRecord* next = record->next;
+        for(unsigned int i = 0; i < num_limbo_lists_; i++){
+            free_list(record->limbo[i]);
+        }
+        delete record;
+        record = next;
+    }
+}
+
+/**
+ * @name: get_record()
+ * @brief: return the record of the calling thread, claim or create it on first use
+ * @return: ThreadRecord*, record owned by the calling thread
+ */
+EpochDomain::ThreadRecord* EpochDomain::get_record()
+{
+    return static_cast<ThreadRecord*>(ThreadRecords::get(this, id_, &claim_record, &release_record));
+}
+
+/**
+ * @name: claim_record()
+ * @brief: reuse the record of an exited thread or create one, called by
+ * ThreadRecords with the registry mutex held
+ * @param domain: pointer to the domain
+ * @return: void*, record owned by the calling thread
+ */
+void* EpochDomain::claim_record(void* domain)
+{
+    EpochDomain* self = static_cast<EpochDomain*>(domain);
+    // reuse the record of an exited thread, its pending nodes are inherited
+    ThreadRecord* record = self->records_.load(std::memory_order_acquire);
+    for(; record != nullptr; record = record->next){
+        bool expected = false;
+        if(!record->in_use.load(std::memory_order_relaxed) &&
+           record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)){
+            break;
+        }
+    }
+
+    if(record == nullptr){
+        record = new ThreadRecord;
+        record->epoch.store(inactive_, std::memory_order_relaxed);
+        record->in_use.store(true, std::memory_order_relaxed);
+        record->nesting = 0;
+        record->num_retired = 0;
+        for(unsigned int i = 0; i < num_limbo_lists_; i++){
+            record->limbo_epochs[i] = 0;
+        }
+        ThreadRecord* head = self->records_.load(std::memory_order_relaxed);
+        do{
+            record->next = head;
+        }while(!self->records_.compare_exchange_weak(head, record, std::memory_order_release,
+                                                     std::memory_order_relaxed));
+    }
+    return record;
+}
+
+/**
+ * @name: release_record()
+ * @brief: collect and release the record of an exiting thread, called by
+ * ThreadRecords with the registry mutex held
+ * @param domain: pointer to the domain
+ * @param record: record owned by the exiting thread
+ */
+void EpochDomain::release_record(void* domain, void* record)
+{
+    EpochDomain* self = static_cast<EpochDomain*>(domain);
+    ThreadRecord* owned = static_cast<ThreadRecord*>(record);
+    self->collect(owned);
+    owned->nesting = 0;
+    owned->epoch.store(inactive_, std::memory_order_release);
+    owned->in_use.store(false, std::memory_order_release);
+}
+
+/**
+ * @name: try_advance()
+ * @brief: advance the global epoch if all active records observed it
+ * @return: uint64_t, global epoch after the attempt
+ */
+uint64_t EpochDomain::try_advance()
+{
+    uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+    for(ThreadRecord* record = records_.load(std::memory_order_acquire);
+        record != nullptr; record = record->next){
+        const uint64_t pinned = record->epoch.load(std::memory_order_seq_cst);
+        if(pinned != inactive_ && pinned != epoch){
+            return epoch;
+        }
+    }
+    // a failed exchange means another thread advanced, epoch holds its value then
+    if(epoch_.compare_exchange_strong(epoch, epoch + 1, std::memory_order_seq_cst)){
+        epoch++;
+    }
+    return epoch;
+}
+
+/**
+ * @name: free_list()
+ * @brief: free all nodes of a limbo list
+ * @param list: limbo list, emptied
+ */
+void EpochDomain::free_list(std::vector<Retired>& list)
+{
+    for(const Retired& retired : list){
+        retired.deleter(retired.pointer);
+    }
+    num_freed_.fetch_add(list.size(), std::memory_order_relaxed);
+    list.clear();
+}
+
+/**
+ * @name: collect()
+ * @brief: advance the epoch if possible and free the safe limbo lists of a record
+ * @param record: record owned by the calling thread
+ */
+void EpochDomain::collect(ThreadRecord* record)
+{
+    const uint64_t epoch = try_advance();
+    // guards pinned before the retirement are gone once the epoch advanced twice
+    for(unsigned int i = 0; i < num_limbo_lists_; i++){
+        if(!record->limbo[i].empty() && record->limbo_epochs[i] + 2 <= epoch){
+            free_list(record->limbo[i]);
+        }
+    }
+    record->num_retired = 0;
+}
+
+/**
+ * @name: retire_erased()
+ * @brief: put a node into the limbo list of the current epoch
+ * @param pointer: unlinked node
+ * @param deleter: frees the node
+ */
+void EpochDomain::retire_erased(void* pointer, void (*deleter)(void*))
+{
+    ThreadRecord* record = get_record();
+    const uint64_t epoch = epoch_.load(std::memory_order_seq_cst);
+    const unsigned int index = epoch % num_limbo_lists_;
+    // a list of another epoch is at least three epochs old, hence safe
+    if(record->limbo_epochs[index] != epoch){
+        free_list(record->limbo[index]);
+        record->limbo_epochs[index] = epoch;
+    }
+    record->limbo[index].push_back({pointer, deleter});
+    if(++record->num_retired >= retire_batch_){
+        collect(record);
+    }
+}
+
+/**
+ * @name: collect()
+ * @brief: try to advance the epoch and free the safe nodes retired by the calling thread
+ */
+void EpochDomain::collect()
+{
+    collect(get_record());
+}
+
+/**
+ * @name: get_epoch()
+ * @brief: return the global epoch
+ * @return: uint64_t, global epoch
+ */
+uint64_t EpochDomain::get_epoch() const
+{
+    return epoch_.load(std::memory_order_acquire);
+}
+
+/**
+ * @name: get_num_pending()
+ * @brief: return the number of nodes retired by the calling thread and not yet freed
+ * @return: std::size_t, number of pending nodes
+ */
+std::size_t EpochDomain::get_num_pending()
+{
+    ThreadRecord* record = get_record();
+    std::size_t num_pending = 0;
+    for(unsigned int i = 0; i < num_limbo_lists_; i++){
+        num_pending += record->limbo[i].size();
+    }
+    return num_pending;
+}
+
+/**
+ * @name: get_num_freed()
+ * @brief: return the number of freed nodes of all threads
+ * @return: uint64_t, number of freed nodes
+ */
+uint64_t EpochDomain::get_num_freed() const
+{
+    return num_freed_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @name: get_global()
+ * @brief: return the domain shared by the library
+ * @return: EpochDomain&, shared domain
+ */
+EpochDomain& EpochDomain::get_global()
+{
+    static EpochDomain domain;
+    return domain;
+}
+
+/**
+ * @name: Guard()
+ * @brief: Constructor, enter the critical region
+ * @param domain: guarded domain, the global domain by default
+ */
+EpochDomain::Guard::Guard(EpochDomain& domain)
+    : domain_(domain)
+{
+    record_ = domain_.get_record();
+    if(record_->nesting++ == 0){
+        record_->epoch.store(domain_.epoch_.load(std::memory_order_relaxed), std::memory_order_relaxed);
+        // publish the pin before any shared node is read
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+}
+
+/**
+ * @name: ~Guard()
+ * @brief: Destructor, leave the critical region
+ */
+EpochDomain::Guard::~Guard()
+{
+    if(--record_->nesting == 0){
+        record_->epoch.store(inactive_, std::memory_order_release);
+    }
+}
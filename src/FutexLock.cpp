@@ -0,0 +1,165 @@
+/**
+ * @file    : FutexLock.cpp
+ * @brief   : Cpp file of spin-then-park Lock based on futex
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#include "../include/FutexLock.hpp"
+#include <algorithm>    //< for std::min and std::max
+
+/**
+ * @name: FutexLock()
+ * @brief: Default Constructor
+ * @param max_spin_in_ns: upper bound of the adaptive spin budget,
+ * spinning is disabled on single CPU machines
+ */
+FutexLock::FutexLock(uint64_t max_spin_in_ns)
+{
+    state_ = unlocked_;
+    avg_hold_in_ns_ = 0;
+    // the owner cannot make progress while a waiter spins on the only CPU
+    max_spin_in_ns_ = (std::thread::hardware_concurrency() > 1) ? max_spin_in_ns : 0;
+    acquisitions_ = 0;
+}
+
+/**
+ * @name: start_hold()
+ * @brief: start the hold time measurement for sampled acquisitions
+ */
+void FutexLock::start_hold()
+{
+    // only every 2^sample_shift_-th acquisition reads the clock
+    if((++acquisitions_ & ((1u << sample_shift_) - 1)) == 0){
+        hold_start_ = high_res_clock::now();
+    }
+}
+
+/**
+ * @name: acquire()
+ * @brief: lock the futex lock before entering critical region
+ */
+void FutexLock::acquire()
+{
+    // fast path: uncontended lock
+    uint32_t expected = unlocked_;
+    if(state_.compare_exchange_strong(expected, locked_, std::memory_order_acquire,
+                                      std::memory_order_relaxed)){
+        start_hold();
+        return;
+    }
+
+    // spin for the adaptive budget, check the clock every 64 iterations
+    const uint64_t budget_in_ns = get_spin_budget_in_ns();
+    if(budget_in_ns > 0){
+        const high_res_clock::time_point spin_start = high_res_clock::now();
+        for(unsigned int spins = 1; ; spins++){
+            if(state_.load(std::memory_order_relaxed) == unlocked_){
+                expected = unlocked_;
+                if(state_.compare_exchange_weak(expected, locked_, std::memory_order_acquire,
+                                                std::memory_order_relaxed)){
+                    start_hold();
+                    return;
+                }
+            }
+            cpu_relax();
+            if(spins % 64 == 0 && uint64_t(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   high_res_clock::now() - spin_start).count()) > budget_in_ns){
+                break;
+            }
+        }
+    }
+
+    // park: mark the lock as contended and sleep until the owner wakes us up
+    uint32_t state = state_.exchange(contended_, std::memory_order_acquire);
+    while(state != unlocked_){
+        futex_wait(&state_, contended_);
+        state = state_.exchange(contended_, std::memory_order_acquire);
+    }
+    start_hold();
+}
+
+/**
+ * @name: release()
+ * @brief: unlock the futex lock before leaving critical region
+ */
+void FutexLock::release()
+{
+    // update the moving average of the hold times with weight 1/8
+    if((acquisitions_ & ((1u << sample_shift_) - 1)) == 0){
+        // high_res_clock is not guaranteed to be monotonic
+        const int64_t hold_in_ns = std::max<int64_t>(0, std::chrono::duration_cast<std::chrono::nanoseconds>(
+            high_res_clock::now() - hold_start_).count());
+        const int64_t avg_in_ns = avg_hold_in_ns_.load(std::memory_order_relaxed);
+        avg_hold_in_ns_.store(avg_in_ns + (hold_in_ns - avg_in_ns) / 8, std::memory_order_relaxed);
+    }
+
+    // only wake up a waiter if one might sleep
+    if(state_.exchange(unlocked_, std::memory_order_release) == contended_){
+        futex_wake(&state_, 1);
+    }
+}
+
+/**
+ * @name: get_spin_budget_in_ns()
+ * @brief: return the current spin budget of a waiter before parking
+ * @return: uint64_t, spin budget in ns
+ */
+uint64_t FutexLock::get_spin_budget_in_ns() const
+{
+    if(max_spin_in_ns_ == 0){
+        return 0;
+    }
+    // spinning longer than twice the typical hold time is wasted
+    const uint64_t avg_in_ns = avg_hold_in_ns_.load(std::memory_order_relaxed);
+    if(avg_in_ns > max_spin_in_ns_){
+        return std::min(min_spin_in_ns_, max_spin_in_ns_);
+    }
+    return std::min(2 * avg_in_ns + min_spin_in_ns_, max_spin_in_ns_);
+}
+
+/**
+ * @name: try_acquire()
+ * @brief: try to lock the futex lock once without waiting
+ * @return: boolean, true if the lock was acquired
+ */
+bool FutexLock::try_acquire()
+{
+    uint32_t expected = unlocked_;
+    if(state_.compare_exchange_strong(expected, locked_, std::memory_order_acquire,
+                                      std::memory_order_relaxed)){
+        start_hold();
+        return true;
+    }
+    return false;
+}
+
+/**
+ * @name: lock()
+ * @brief: Lockable interface, same as acquire()
+ */
+void FutexLock::lock()
+{
+    acquire();
+}
+
+/**
+ * @name: unlock()
+ * @brief: Lockable interface, same as release()
+ */
+void FutexLock::unlock()
+{
+    release();
+}
+
+/**
+ * @name: try_lock()
+ * @brief: Lockable interface, same as try_acquire()
+ * @return: boolean, true if the lock was acquired
+ */
+bool FutexLock::try_lock()
+{
+    return try_acquire();
+}
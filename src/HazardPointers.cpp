@@ -0,0 +1,243 @@
+/**
+ * @file    : HazardPointers.cpp
+ * @brief   : Cpp file of hazard pointer memory reclamation for lock-free
+ * data structures
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#include "../include/HazardPointers.hpp"
+#include "../include/ThreadRecords.hpp"
+#include <algorithm>    //< for std::sort and std::binary_search
+#include <stdexcept>    //< for std::runtime_error
+
+/**
+ * @name: HazardDomain()
+ * @brief: Constructor
+ * @param retire_threshold: length of a retire list which triggers a scan,
+ * raised to twice the number of slots of all threads
+ */
+HazardDomain::HazardDomain(std::size_t retire_threshold)
+{
+    id_ = ThreadRecords::add_domain();
+    retire_threshold_ = (retire_threshold > 0) ? retire_threshold : 1;
+    records_.store(nullptr, std::memory_order_relaxed);
+    num_records_.store(0, std::memory_order_relaxed);
+    num_retired_.store(0, std::memory_order_relaxed);
+    num_freed_.store(0, std::memory_order_relaxed);
+}
+
+/**
+ * @name: ~HazardDomain()
+ * @brief: Destructor, frees all retired nodes, no hazard may be alive
+ */
+HazardDomain::~HazardDomain()
+{
+    ThreadRecords::remove_domain(id_);
+    ThreadRecord* record = records_.load(std::memory_order_acquire);
+    while(record != nullptr){
+        ThreadRecord* next = record->next;
+        for(const Retired& retired : record->retired){
+            retired.deleter(retired.pointer);
+        }
+        delete record;
+        record = next;
+    }
+}
+
+/**
+ * @name: get_record()
+ * @brief: return the record of the calling thread, claim or create it on first use
+ * @return: ThreadRecord*, record owned by the calling thread
+ */
+HazardDomain::ThreadRecord* HazardDomain::get_record()
+{
+    return static_cast<ThreadRecord*>(ThreadRecords::get(this, id_, &claim_record, &release_record));
+}
+
+/**
+ * @name: claim_record()
+ * @brief: reuse the record of an exited thread or create one, called by
+ * ThreadRecords with the registry mutex held
+ * @param domain: pointer to the domain
+ * @return: void*, record owned by the calling thread
+ */
+void* HazardDomain::claim_record(void* domain)
+{
+    HazardDomain* self = static_cast<HazardDomain*>(domain);
+    // reuse the record of an exited thread, its retired nodes are inherited
+    ThreadRecord* record = self->records_.load(std::memory_order_acquire);
+    for(; record != nullptr; record = record->next){
+        bool expected = false;
+        if(!record->in_use.load(std::memory_order_relaxed) &&
+           record->in_use.compare_exchange_strong(expected, true, std::memory_order_acquire)){
+            break;
+        }
+    }
+
+    if(record == nullptr){
+        record = new ThreadRecord;
+        for(unsigned int i = 0; i < max_slots; i++){
+            record->slots[i].store(nullptr, std::memory_order_relaxed);
+        }
+        record->in_use.store(true, std::memory_order_relaxed);
+        record->used_slots = 0;
+        ThreadRecord* head = self->records_.load(std::memory_order_relaxed);
+        do{
+            record->next = head;
+        }while(!self->records_.compare_exchange_weak(head, record, std::memory_order_release,
+                                                     std::memory_order_relaxed));
+        self->num_records_.fetch_add(1, std::memory_order_relaxed);
+    }
+    return record;
+}
+
+/**
+ * @name: release_record()
+ * @brief: scan and release the record of an exiting thread, called by
+ * ThreadRecords with the registry mutex held
+ * @param domain: pointer to the domain
+ * @param record: record owned by the exiting thread
+ */
+void HazardDomain::release_record(void* domain, void* record)
+{
+    HazardDomain* self = static_cast<HazardDomain*>(domain);
+    ThreadRecord* owned = static_cast<ThreadRecord*>(record);
+    for(unsigned int i = 0; i < max_slots; i++){
+        owned->slots[i].store(nullptr, std::memory_order_relaxed);
+    }
+    owned->used_slots = 0;
+    self->scan(owned);
+    owned->in_use.store(false, std::memory_order_release);
+}
+
+/**
+ * @name: scan()
+ * @brief: free the nodes of a retire list which are in no slot
+ * @param record: record owned by the calling thread
+ */
+void HazardDomain::scan(ThreadRecord* record)
+{
+    // the nodes are unlinked before, a reader publishing one later fails its validation
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::vector<void*> hazards;
+    for(ThreadRecord* other = records_.load(std::memory_order_acquire);
+        other != nullptr; other = other->next){
+        for(unsigned int i = 0; i < max_slots; i++){
+            void* pointer = other->slots[i].load(std::memory_order_acquire);
+            if(pointer != nullptr){
+                hazards.push_back(pointer);
+            }
+        }
+    }
+    std::sort(hazards.begin(), hazards.end());
+
+    std::vector<Retired>& retired = record->retired;
+    std::size_t num_kept = 0;
+    for(std::size_t i = 0; i < retired.size(); i++){
+        if(std::binary_search(hazards.begin(), hazards.end(), retired[i].pointer)){
+            retired[num_kept++] = retired[i];
+        }else{
+            retired[i].deleter(retired[i].pointer);
+        }
+    }
+    num_freed_.fetch_add(retired.size() - num_kept, std::memory_order_relaxed);
+    retired.resize(num_kept);
+}
+
+/**
+ * @name: retire_erased()
+ * @brief: put a node into the retire list of the calling thread
+ * @param pointer: unlinked node
+ * @param deleter: frees the node
+ */
+void HazardDomain::retire_erased(void* pointer, void (*deleter)(void*))
+{
+    ThreadRecord* record = get_record();
+    record->retired.push_back({pointer, deleter});
+    num_retired_.fetch_add(1, std::memory_order_relaxed);
+    if(record->retired.size() >= get_retire_threshold()){
+        scan(record);
+    }
+}
+
+/**
+ * @name: scan()
+ * @brief: free the unprotected nodes retired by the calling thread
+ */
+void HazardDomain::scan()
+{
+    scan(get_record());
+}
+
+/**
+ * @name: get_retire_threshold()
+ * @brief: return the length of a retire list which triggers a scan
+ * @return: std::size_t, current threshold
+ */
+std::size_t HazardDomain::get_retire_threshold() const
+{
+    // at most half of the list can be protected, a scan frees the other half
+    const std::size_t min_threshold = 2 * max_slots * num_records_.load(std::memory_order_relaxed);
+    return std::max(retire_threshold_, min_threshold);
+}
+
+/**
+ * @name: get_num_pending()
+ * @brief: return the number of retired nodes of all threads not yet freed
+ * @return: uint64_t, number of pending nodes
+ */
+uint64_t HazardDomain::get_num_pending() const
+{
+    return num_retired_.load(std::memory_order_relaxed) - num_freed_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @name: get_num_freed()
+ * @brief: return the number of freed nodes of all threads
+ * @return: uint64_t, number of freed nodes
+ */
+uint64_t HazardDomain::get_num_freed() const
+{
+    return num_freed_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @name: get_global()
+ * @brief: return the domain shared by the library
+ * @return: HazardDomain&, shared domain
+ */
+HazardDomain& HazardDomain::get_global()
+{
+    static HazardDomain domain;
+    return domain;
+}
+
+/**
+ * @name: Hazard()
+ * @brief: Constructor, take a free slot of the calling thread
+ * @param domain: domain of the protected nodes, the global domain by default
+ */
+HazardDomain::Hazard::Hazard(HazardDomain& domain)
+{
+    record_ = domain.get_record();
+    const unsigned int free_slots = ~record_->used_slots & ((1u << max_slots) - 1);
+    if(free_slots == 0){
+        throw std::runtime_error("HazardDomain: more than max_slots hazards in one thread");
+    }
+    index_ = __builtin_ctz(free_slots);
+    record_->used_slots |= 1u << index_;
+    slot_ = &record_->slots[index_];
+}
+
+/**
+ * @name: ~Hazard()
+ * @brief: Destructor, clear and give back the slot
+ */
+HazardDomain::Hazard::~Hazard()
+{
+    slot_->store(nullptr, std::memory_order_release);
+    record_->used_slots &= ~(1u << index_);
+}
@@ -0,0 +1,292 @@
+/**
+ * @file    : InstrumentedLock.cpp
+ * @brief   : Cpp file of lock contention profiling statistics
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#include "../include/InstrumentedLock.hpp"
+#include "../include/concurrency_utils.hpp"
+#include <mutex>        //< for std::lock_guard of the registry
+#include <vector>       //< for std::vector of the ranking
+#include <utility>      //< for std::pair of the ranking
+#include <algorithm>    //< for std::sort
+#include <iomanip>      //< for std::setw
+
+/**
+ * @name: get_registry()
+ * @brief: return the registry of all living statistics
+ */
+static ObjectRegistry<const LockStatistics*>& get_registry()
+{
+    static ObjectRegistry<const LockStatistics*> registry;
+    return registry;
+}
+
+/**
+ * @name: LockStatistics()
+ * @brief: Constructor, register the statistics for the report
+ * @param name: string, name of the lock in the report
+ */
+LockStatistics::LockStatistics(const std::string& name)
+    : LockStatistics(name, true)
+{
+}
+
+/**
+ * @name: LockStatistics()
+ * @brief: Constructor
+ * @param name: string, name of the lock in the report
+ * @param registered: boolean, true to list the statistics in the report
+ */
+LockStatistics::LockStatistics(const std::string& name, bool registered)
+    : name_(name), registered_(registered)
+{
+    reset();
+    if(registered_){
+        get_registry().add(this);
+    }
+}
+
+/**
+ * @name: LockStatistics()
+ * @brief: Destructor, unregister the statistics
+ */
+LockStatistics::~LockStatistics()
+{
+    if(registered_){
+        get_registry().remove(this);
+    }
+}
+
+/**
+ * @name: get_bucket()
+ * @brief: return the histogram bucket of a duration
+ * @param ns: unsigned long, duration in ns
+ * @return: unsigned int, index of the bucket
+ */
+unsigned int LockStatistics::get_bucket(unsigned long ns)
+{
+    if(ns == 0){
+        return 0;
+    }
+    // number of significant bits, i.e. floor(log2(ns)) + 1
+    const unsigned int bits = 64 - __builtin_clzl(ns);
+    return (bits < num_buckets) ? bits : num_buckets - 1;
+}
+
+/**
+ * @name: get_percentile()
+ * @brief: return the upper bucket bound of a percentile of a histogram
+ * @param histogram: pointer to the num_buckets counters
+ * @param percentile: double in [0, 1]
+ * @return: unsigned long, upper bound of the bucket in ns
+ */
+unsigned long LockStatistics::get_percentile(const std::atomic<unsigned long>* histogram, double percentile)
+{
+    unsigned long total = 0;
+    for(unsigned int i = 0; i < num_buckets; i++){
+        total += histogram[i].load(std::memory_order_relaxed);
+    }
+    if(total == 0){
+        return 0;
+    }
+    const double rank = percentile * total;
+    unsigned long count = 0;
+    for(unsigned int i = 0; i < num_buckets; i++){
+        count += histogram[i].load(std::memory_order_relaxed);
+        if(count >= rank && count > 0){
+            return (i == 0) ? 0 : (1ul << i) - 1;
+        }
+    }
+    return (1ul << (num_buckets - 1)) - 1;
+}
+
+/**
+ * @name: record_acquire()
+ * @brief: record one acquisition
+ * @param contended: boolean, true if the lock was not free at the first attempt
+ * @param wait_in_ns: unsigned long, waiting time in ns
+ */
+void LockStatistics::record_acquire(bool contended, unsigned long wait_in_ns)
+{
+    acquisitions_.fetch_add(1, std::memory_order_relaxed);
+    if(contended){
+        contended_.fetch_add(1, std::memory_order_relaxed);
+        wait_in_ns_.fetch_add(wait_in_ns, std::memory_order_relaxed);
+    }
+    wait_histogram_[get_bucket(wait_in_ns)].fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @name: record_release()
+ * @brief: record one release
+ * @param hold_in_ns: unsigned long, holding time in ns
+ */
+void LockStatistics::record_release(unsigned long hold_in_ns)
+{
+    hold_in_ns_.fetch_add(hold_in_ns, std::memory_order_relaxed);
+    hold_histogram_[get_bucket(hold_in_ns)].fetch_add(1, std::memory_order_relaxed);
+}
+
+/**
+ * @name: reset()
+ * @brief: clear all counters and histograms
+ */
+void LockStatistics::reset()
+{
+    acquisitions_ = 0;
+    contended_ = 0;
+    wait_in_ns_ = 0;
+    hold_in_ns_ = 0;
+    for(unsigned int i = 0; i < num_buckets; i++){
+        wait_histogram_[i] = 0;
+        hold_histogram_[i] = 0;
+    }
+}
+
+/**
+ * @name: get_name()
+ * @brief: return the name of the lock in the report
+ * @return: const std::string&, name of the lock
+ */
+const std::string& LockStatistics::get_name() const
+{
+    return name_;
+}
+
+/**
+ * @name: get_acquisitions()
+ * @brief: return the number of acquisitions
+ * @return: unsigned long, number of acquisitions
+ */
+unsigned long LockStatistics::get_acquisitions() const
+{
+    return acquisitions_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @name: get_contended()
+ * @brief: return the number of acquisitions which had to wait
+ * @return: unsigned long, number of contended acquisitions
+ */
+unsigned long LockStatistics::get_contended() const
+{
+    return contended_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @name: get_wait_in_ns()
+ * @brief: return the total waiting time
+ * @return: unsigned long, total waiting time in ns
+ */
+unsigned long LockStatistics::get_wait_in_ns() const
+{
+    return wait_in_ns_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @name: get_hold_in_ns()
+ * @brief: return the total holding time
+ * @return: unsigned long, total holding time in ns
+ */
+unsigned long LockStatistics::get_hold_in_ns() const
+{
+    return hold_in_ns_.load(std::memory_order_relaxed);
+}
+
+/**
+ * @name: get_wait_percentile_in_ns()
+ * @brief: return an upper bound of a waiting time percentile
+ * @param percentile: double in [0, 1]
+ * @return: unsigned long, upper bound of the histogram bucket in ns
+ */
+unsigned long LockStatistics::get_wait_percentile_in_ns(double percentile) const
+{
+    return get_percentile(wait_histogram_, percentile);
+}
+
+/**
+ * @name: get_hold_percentile_in_ns()
+ * @brief: return an upper bound of a holding time percentile
+ * @param percentile: double in [0, 1]
+ * @return: unsigned long, upper bound of the histogram bucket in ns
+ */
+unsigned long LockStatistics::get_hold_percentile_in_ns(double percentile) const
+{
+    return get_percentile(hold_histogram_, percentile);
+}
+
+/**
+ * @name: print()
+ * @brief: print counters and histograms of this lock
+ * @param out: output stream
+ */
+void LockStatistics::print(std::ostream& out) const
+{
+    const unsigned long acquisitions = get_acquisitions();
+    out << "lock " << name_ << ": " << acquisitions << " acquisitions, "
+        << get_contended() << " contended, "
+        << get_wait_in_ns() << " ns waiting, " << get_hold_in_ns() << " ns holding\n";
+    out << std::setw(22) << "bucket [ns]" << std::setw(14) << "wait" << std::setw(14) << "hold" << "\n";
+    for(unsigned int i = 0; i < num_buckets; i++){
+        const unsigned long wait = wait_histogram_[i].load(std::memory_order_relaxed);
+        const unsigned long hold = hold_histogram_[i].load(std::memory_order_relaxed);
+        if(wait == 0 && hold == 0){
+            continue;
+        }
+        const unsigned long lower = (i == 0) ? 0 : (1ul << (i - 1));
+        const unsigned long upper = (i == 0) ? 0 : (1ul << i) - 1;
+        out << std::setw(10) << lower << " - " << std::setw(9) << upper
+            << std::setw(14) << wait << std::setw(14) << hold << "\n";
+    }
+}
+
+/**
+ * @name: report()
+ * @brief: print all registered locks ranked by total waiting time
+ * @param out: output stream
+ * @param max_locks: maximal number of printed locks
+ */
+void LockStatistics::report(std::ostream& out, unsigned int max_locks)
+{
+    ObjectRegistry<const LockStatistics*>& registry = get_registry();
+    std::lock_guard<std::mutex> guard(registry.get_mutex());
+    // snapshot of the waiting times, the profiled locks keep updating them while sorting
+    std::vector<std::pair<unsigned long, const LockStatistics*>> ranking;
+    ranking.reserve(registry.get_objects().size());
+    for(const LockStatistics* statistics : registry.get_objects()){
+        ranking.emplace_back(statistics->get_wait_in_ns(), statistics);
+    }
+    std::sort(ranking.begin(), ranking.end(), [](const auto& a, const auto& b){
+        return a.first > b.first;
+    });
+
+    out << std::setw(5) << "rank" << std::setw(20) << "lock" << std::setw(14) << "acquisitions"
+        << std::setw(12) << "contended" << std::setw(14) << "wait [ns]"
+        << std::setw(12) << "wait p99" << std::setw(14) << "hold [ns]" << std::setw(12) << "hold p99" << "\n";
+    for(unsigned int rank = 0; rank < ranking.size() && rank < max_locks; rank++){
+        const LockStatistics& statistics = *ranking[rank].second;
+        out << std::setw(5) << rank + 1 << std::setw(20) << statistics.get_name()
+            << std::setw(14) << statistics.get_acquisitions()
+            << std::setw(12) << statistics.get_contended()
+            << std::setw(14) << ranking[rank].first
+            << std::setw(12) << statistics.get_wait_percentile_in_ns(0.99)
+            << std::setw(14) << statistics.get_hold_in_ns()
+            << std::setw(12) << statistics.get_hold_percentile_in_ns(0.99) << "\n";
+    }
+}
+
+/**
+ * @name: get_disabled()
+ * @brief: return the empty statistics of all locks without profiling,
+ * not listed in the report
+ * @return: const LockStatistics&, statistics without recorded acquisitions
+ */
+const LockStatistics& LockStatistics::get_disabled()
+{
+    static const LockStatistics disabled("disabled", false);
+    return disabled;
+}
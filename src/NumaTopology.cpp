@@ -0,0 +1,179 @@
+/**
+ * @file    : NumaTopology.cpp
+ * @brief   : Cpp file of NUMA topology discovery based on sysfs
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#include "../include/NumaTopology.hpp"
+#include <filesystem>   //< for std::filesystem::directory_iterator
+#include <fstream>      //< for std::ifstream
+#include <sstream>      //< for std::stringstream
+#include <algorithm>    //< for std::sort
+#include <thread>       //< for std::thread::hardware_concurrency
+#include <utility>      //< for std::pair
+#include <sched.h>      //< for sched_getcpu and CPU_SETSIZE
+
+/**
+ * @name: parse_cpulist()
+ * @brief: parse a kernel cpulist like "0-3,8-11" into CPU numbers
+ * @param cpulist: string, content of a cpulist file
+ * @return: std::vector<unsigned int>, CPU numbers of the list
+ */
+static std::vector<unsigned int> parse_cpulist(const std::string& cpulist)
+{
+    std::vector<unsigned int> cpus;
+    std::stringstream stream(cpulist);
+    std::string range;
+    while(std::getline(stream, range, ',')){
+        if(range.empty() || range == "\n"){
+            continue;
+        }
+        try{
+            const std::size_t dash = range.find('-');
+            const unsigned long first = std::stoul(range.substr(0, dash));
+            const unsigned long last = (dash == std::string::npos) ? first : std::stoul(range.substr(dash + 1));
+            // the kernel never reports CPU numbers beyond CPU_SETSIZE, reject before narrowing
+            if(last < first || last >= CPU_SETSIZE){
+                continue;
+            }
+            for(unsigned long cpu = first; cpu <= last; cpu++){
+                cpus.push_back(static_cast<unsigned int>(cpu));
+            }
+        }catch(const std::exception& e){
+            // ignore malformed ranges, the topology falls back to node 0
+        }
+    }
+    return cpus;
+}
+
+/**
+ * @name: NumaTopology()
+ * @brief: Default Constructor, read the topology of this machine
+ */
+NumaTopology::NumaTopology() : NumaTopology("/sys/devices/system/node")
+{
+}
+
+/**
+ * @name: NumaTopology()
+ * @brief: Constructor reading the topology from a sysfs-like directory
+ * @param sysfs_path: directory with node<N>/cpulist entries
+ */
+NumaTopology::NumaTopology(const std::string& sysfs_path)
+{
+    // collect (kernel node id, cpus) of every node<N> directory
+    std::vector<std::pair<unsigned int, std::vector<unsigned int>>> nodes;
+    std::error_code error;
+    for(const auto& entry : std::filesystem::directory_iterator(sysfs_path, error)){
+        const std::string name = entry.path().filename().string();
+        if(name.size() < 5 || name.compare(0, 4, "node") != 0
+           || name.find_first_not_of("0123456789", 4) != std::string::npos){
+            continue;
+        }
+        std::ifstream file(entry.path() / "cpulist");
+        std::string cpulist;
+        if(!std::getline(file, cpulist)){
+            continue;
+        }
+        std::vector<unsigned int> cpus = parse_cpulist(cpulist);
+        if(!cpus.empty()){
+            nodes.emplace_back(std::stoul(name.substr(4)), std::move(cpus));
+        }
+    }
+
+    // fallback: a single node owning all CPUs
+    if(nodes.empty()){
+        num_nodes_ = 1;
+        node_of_cpu_.assign(std::max(1u, std::thread::hardware_concurrency()), 0);
+        return;
+    }
+
+    // kernel node ids can have holes, use dense indices in id order
+    std::sort(nodes.begin(), nodes.end());
+    num_nodes_ = nodes.size();
+    for(unsigned int node = 0; node < num_nodes_; node++){
+        for(const unsigned int cpu : nodes[node].second){
+            if(cpu >= node_of_cpu_.size()){
+                node_of_cpu_.resize(cpu + 1, -1);
+            }
+            node_of_cpu_[cpu] = node;
+        }
+    }
+}
+
+/**
+ * @name: get_num_nodes()
+ * @brief: return the number of NUMA nodes, at least one
+ * @return: unsigned int, number of NUMA nodes
+ */
+unsigned int NumaTopology::get_num_nodes() const
+{
+    return num_nodes_;
+}
+
+/**
+ * @name: get_num_cpus()
+ * @brief: return the number of CPUs known to the topology
+ * @return: unsigned int, number of CPUs
+ */
+unsigned int NumaTopology::get_num_cpus() const
+{
+    return std::count_if(node_of_cpu_.begin(), node_of_cpu_.end(),
+                         [](int node){ return node >= 0; });
+}
+
+/**
+ * @name: get_node_of_cpu()
+ * @brief: return the node index of a CPU, unknown CPUs belong to node 0
+ * @param cpu: unsigned int, CPU number as reported by the kernel
+ * @return: unsigned int, dense node index in [0, get_num_nodes())
+ */
+unsigned int NumaTopology::get_node_of_cpu(unsigned int cpu) const
+{
+    return (cpu < node_of_cpu_.size() && node_of_cpu_[cpu] >= 0) ? node_of_cpu_[cpu] : 0;
+}
+
+/**
+ * @name: get_current_node()
+ * @brief: return the node index of the CPU running the calling thread
+ * @return: unsigned int, dense node index in [0, get_num_nodes())
+ */
+unsigned int NumaTopology::get_current_node() const
+{
+    if(num_nodes_ == 1){
+        return 0;
+    }
+    const int cpu = sched_getcpu();
+    return (cpu < 0) ? 0 : get_node_of_cpu(cpu);
+}
+
+/**
+ * @name: get_cpus_of_node()
+ * @brief: return all CPUs of a node
+ * @param node: unsigned int, dense node index
+ * @return: std::vector<unsigned int>, CPU numbers of the node
+ */
+std::vector<unsigned int> NumaTopology::get_cpus_of_node(unsigned int node) const
+{
+    std::vector<unsigned int> cpus;
+    for(unsigned int cpu = 0; cpu < node_of_cpu_.size(); cpu++){
+        if(node_of_cpu_[cpu] == int(node)){
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+/**
+ * @name: get_system()
+ * @brief: return the topology of this machine, read once
+ * @return: const NumaTopology&, shared topology
+ */
+const NumaTopology& NumaTopology::get_system()
+{
+    static const NumaTopology topology;
+    return topology;
+}
@@ -0,0 +1,48 @@
+/**
+ * @file    : Rseq.cpp
+ * @brief   : Cpp file of restartable sequences (rseq) for per-CPU operations
+ * without atomic instructions
+ * @author  : David Blickenstorfer
+ * 
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#include "../include/Rseq.hpp"
+#include <fstream>      //< for /sys/devices/system/cpu/possible
+#include <string>       //< for std::string
+#include <algorithm>    //< for std::max
+#include <unistd.h>     //< for sysconf
+
+/**
+ * @name: read_num_possible_cpus()
+ * @brief: return the largest possible CPU number plus one, the CPU numbers may
+ * have gaps, so the number of configured CPUs is only a fallback
+ * @return: std::size_t, number of per-CPU slots
+ */
+static std::size_t read_num_possible_cpus()
+{
+    // a list of ranges like 0-63,128-191, the last number is the largest one
+    std::ifstream file("/sys/devices/system/cpu/possible");
+    std::string list;
+    if(file >> list){
+        const std::size_t begin = list.find_last_of(",-");
+        const std::string last = list.substr(begin == std::string::npos ? 0 : begin + 1);
+        if(!last.empty() && last.find_first_not_of("0123456789") == std::string::npos){
+            return std::stoul(last) + 1;
+        }
+    }
+    return std::size_t(std::max(1l, sysconf(_SC_NPROCESSORS_CONF)));
+}
+
+/**
+ * @name: rseq_get_num_cpus()
+ * @brief: return the number of possible CPU numbers, i.e. the largest CPU
+ * number of the system plus one
+ * @return: std::size_t, number of per-CPU slots
+ */
+std::size_t rseq_get_num_cpus()
+{
+    static const std::size_t num_cpus = read_num_possible_cpus();
+    return num_cpus;
+}
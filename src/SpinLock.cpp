@@ -8,6 +8,7 @@
  */
 
 #include "../include/SpinLock.hpp"
+#include "../include/AtomicPrimitives.hpp"
 
 /**
  * @name: SpinLock()
@@ -25,7 +26,10 @@ SpinLock::SpinLock()
  */
 void SpinLock::acquire()
 {
-    while(!CAS(&locked_, false, true)){
+    // acquire ordering is sufficient, CAS() would be a full barrier
+    bool expected = false;
+    while(!atomic_cas(&locked_, expected, true, std::memory_order_acquire, std::memory_order_relaxed)){
+        expected = false;
         // reduce CPU contention 
         std::this_thread::yield();
     }
@@ -37,6 +41,45 @@ void SpinLock::acquire()
  */
 void SpinLock::release()
 {
-    locked_ = false;
+    // store false with release semantics, keeps the critical region inside
+    atomic_store(&locked_, false, std::memory_order_release);
+}
+
+/**
+ * @name: try_acquire()
+ * @brief: try to lock the CAS lock once without waiting
+ * @return: boolean, true if the lock was acquired
+ */
+bool SpinLock::try_acquire()
+{
+    bool expected = false;
+    return atomic_cas(&locked_, expected, true, std::memory_order_acquire, std::memory_order_relaxed);
+}
+
+/**
+ * @name: lock()
+ * @brief: Lockable interface, same as acquire()
+ */
+void SpinLock::lock()
+{
+    acquire();
+}
+
+/**
+ * @name: unlock()
+ * @brief: Lockable interface, same as release()
+ */
+void SpinLock::unlock()
+{
+    release();
 }
 
+/**
+ * @name: try_lock()
+ * @brief: Lockable interface, same as try_acquire()
+ * @return: boolean, true if the lock was acquired
+ */
+bool SpinLock::try_lock()
+{
+    return try_acquire();
+}
@@ -0,0 +1,356 @@
+/**
+ * @file    : ThreadPool.cpp
+ * @brief   : Cpp file of work-stealing thread pool and task groups
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#include "../include/ThreadPool.hpp"
+#include <algorithm>    //< for std::max
+#include <climits>      //< for INT_MAX
+
+// busy rounds of a waiting thread before it sleeps on the counter
+static const unsigned int spins_before_sleep = 64;
+// sleeping time of a waiting thread, bounds the delay of a missed wake-up
+static const int64_t wait_timeout_in_ns = 1000000;
+
+// pool and worker index of the calling thread, set by the worker threads
+static thread_local const ThreadPool* current_pool = nullptr;
+static thread_local unsigned int current_index = 0;
+
+/**
+ * @name: get_random()
+ * @brief: xorshift generator of the calling thread, picks steal victims
+ * @return: uint64_t, pseudo random number
+ */
+static uint64_t get_random()
+{
+    thread_local uint64_t state = 0x9E3779B97F4A7C15ull * (get_thread_index() + 1);
+    state ^= state << 13;
+    state ^= state >> 7;
+    state ^= state << 17;
+    return state;
+}
+
+/**
+ * @name: TaskGroup()
+ * @brief: Constructor
+ * @param pool: pool executing the tasks
+ */
+TaskGroup::TaskGroup(ThreadPool& pool) : pool_(pool)
+{
+    pending_ = 0;
+}
+
+/**
+ * @name: ~TaskGroup()
+ * @brief: Destructor, waits for the remaining tasks and drops their exceptions
+ */
+TaskGroup::~TaskGroup()
+{
+    pool_.help_until_done(pending_);
+}
+
+/**
+ * @name: wait()
+ * @brief: execute tasks until all tasks of the group finished, rethrows the
+ * first exception of a task
+ */
+void TaskGroup::wait()
+{
+    pool_.help_until_done(pending_);
+    exception_lock_.acquire();
+    std::exception_ptr exception = exception_;
+    exception_ = nullptr;
+    exception_lock_.release();
+    if(exception){
+        std::rethrow_exception(exception);
+    }
+}
+
+/**
+ * @name: ThreadPool()
+ * @brief: Constructor, starts the workers
+ * @param num_threads: number of workers, at least one
+ */
+ThreadPool::ThreadPool(unsigned int num_threads)
+{
+    injection_size_ = 0;
+    pending_ = 0;
+    epoch_ = 0;
+    num_sleeping_ = 0;
+    stop_ = false;
+    num_threads = std::max(1u, num_threads);
+    // all deques exist before a worker might steal
+    for(unsigned int i = 0; i < num_threads; i++){
+        workers_.emplace_back(new Worker);
+    }
+    for(unsigned int i = 0; i < num_threads; i++){
+        workers_[i]->thread = std::thread(&ThreadPool::run_worker, this, i);
+    }
+}
+
+/**
+ * @name: ~ThreadPool()
+ * @brief: Destructor, finishes all tasks and joins the workers
+ */
+ThreadPool::~ThreadPool()
+{
+    help_until_done(pending_);
+    stop_.store(true, std::memory_order_seq_cst);
+    epoch_.fetch_add(1, std::memory_order_seq_cst);
+    futex_wake(&epoch_, INT_MAX);
+    for(auto& worker : workers_){
+        worker->thread.join();
+    }
+}
+
+/**
+ * @name: wait()
+ * @brief: execute tasks until all submitted tasks finished, rethrows the
+ * first exception of a task without group
+ */
+void ThreadPool::wait()
+{
+    help_until_done(pending_);
+    exception_lock_.acquire();
+    std::exception_ptr exception = exception_;
+    exception_ = nullptr;
+    exception_lock_.release();
+    if(exception){
+        std::rethrow_exception(exception);
+    }
+}
+
+/**
+ * @name: get_num_threads()
+ * @brief: return the number of workers
+ * @return: unsigned int, number of workers
+ */
+unsigned int ThreadPool::get_num_threads() const
+{
+    return workers_.size();
+}
+
+/**
+ * @name: get_worker_index()
+ * @brief: return the index of the calling worker
+ * @return: int, index in [0, get_num_threads()) or -1 if the caller is no worker of this pool
+ */
+int ThreadPool::get_worker_index() const
+{
+    return (current_pool == this) ? int(current_index) : -1;
+}
+
+/**
+ * @name: get_global()
+ * @brief: return the pool shared by the parallel algorithms, one worker per
+ * hardware thread, started on first use
+ * @return: ThreadPool&, shared pool
+ */
+ThreadPool& ThreadPool::get_global()
+{
+    static ThreadPool pool;
+    return pool;
+}
+
+/**
+ * @name: get_current_worker()
+ * @brief: return the worker of the calling thread
+ * @return: Worker*, nullptr if the caller is no worker of this pool
+ */
+ThreadPool::Worker* ThreadPool::get_current_worker() const
+{
+    return (current_pool == this) ? workers_[current_index].get() : nullptr;
+}
+
+/**
+ * @name: spawn()
+ * @brief: schedule a task, on the own deque of a worker or the injection queue
+ * @param function: work of the task
+ * @param group: group of the task or nullptr
+ */
+void ThreadPool::spawn(std::function<void()> function, TaskGroup* group)
+{
+    Task* task = new Task{std::move(function), group};
+    // count before publishing, a thief might finish the task immediately
+    if(group != nullptr){
+        group->pending_.fetch_add(1, std::memory_order_relaxed);
+    }
+    pending_.fetch_add(1, std::memory_order_relaxed);
+
+    Worker* worker = get_current_worker();
+    if(worker != nullptr){
+        worker->deque.push(task);
+    }else{
+        injection_lock_.acquire();
+        injection_.push_back(task);
+        injection_size_.fetch_add(1, std::memory_order_relaxed);
+        injection_lock_.release();
+    }
+    notify();
+}
+
+/**
+ * @name: notify()
+ * @brief: wake a parked worker after new work was published
+ */
+void ThreadPool::notify()
+{
+    // pairs with the fence of a parking worker: either it sees the new task
+    // or this thread sees it in num_sleeping_
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if(num_sleeping_.load(std::memory_order_relaxed) > 0){
+        epoch_.fetch_add(1, std::memory_order_release);
+        futex_wake(&epoch_, 1);
+    }
+}
+
+/**
+ * @name: find_task()
+ * @brief: pop the own deque, then the injection queue, then steal
+ * @param worker: worker of the caller or nullptr
+ * @return: Task*, task owned by the caller or nullptr if none was found
+ */
+ThreadPool::Task* ThreadPool::find_task(Worker* worker)
+{
+    Task* task = nullptr;
+    if(worker != nullptr && worker->deque.pop(task)){
+        return task;
+    }
+    if(injection_size_.load(std::memory_order_relaxed) > 0){
+        injection_lock_.acquire();
+        if(!injection_.empty()){
+            task = injection_.front();
+            injection_.pop_front();
+            injection_size_.fetch_sub(1, std::memory_order_relaxed);
+        }
+        injection_lock_.release();
+        if(task != nullptr){
+            return task;
+        }
+    }
+    // visit all other workers once, starting at a random victim
+    const std::size_t num_workers = workers_.size();
+    const std::size_t start = get_random() % num_workers;
+    for(std::size_t i = 0; i < num_workers; i++){
+        Worker* victim = workers_[(start + i) % num_workers].get();
+        if(victim != worker && victim->deque.steal(task)){
+            return task;
+        }
+    }
+    return nullptr;
+}
+
+/**
+ * @name: has_work()
+ * @brief: return if any queue holds tasks, only a snapshot
+ * @return: boolean, true if a task might be found
+ */
+bool ThreadPool::has_work() const
+{
+    if(injection_size_.load(std::memory_order_relaxed) > 0){
+        return true;
+    }
+    for(const auto& worker : workers_){
+        if(!worker->deque.empty()){
+            return true;
+        }
+    }
+    return false;
+}
+
+/**
+ * @name: execute()
+ * @brief: run a task, record its exception and signal completion
+ * @param task: task owned by the caller, deleted afterwards
+ */
+void ThreadPool::execute(Task* task)
+{
+    TaskGroup* group = task->group;
+    try{
+        task->function();
+    }catch(...){
+        SpinLock& lock = (group != nullptr) ? group->exception_lock_ : exception_lock_;
+        std::exception_ptr& exception = (group != nullptr) ? group->exception_ : exception_;
+        lock.acquire();
+        if(!exception){
+            exception = std::current_exception();
+        }
+        lock.release();
+    }
+    delete task;
+    // release: the effects of the task are visible to the waiter.
+    // The group may be destroyed as soon as its counter is zero, the wake-up
+    // then only hits an unrelated address and is harmless.
+    if(group != nullptr && group->pending_.fetch_sub(1, std::memory_order_acq_rel) == 1){
+        futex_wake(&group->pending_, INT_MAX);
+    }
+    if(pending_.fetch_sub(1, std::memory_order_acq_rel) == 1){
+        futex_wake(&pending_, INT_MAX);
+    }
+}
+
+/**
+ * @name: help_until_done()
+ * @brief: execute tasks until the counter reaches zero, sleep if none is found
+ * @param counter: number of unfinished tasks
+ */
+void ThreadPool::help_until_done(std::atomic<uint32_t>& counter)
+{
+    Worker* worker = get_current_worker();
+    unsigned int spins = 0;
+    while(true){
+        const uint32_t remaining = counter.load(std::memory_order_acquire);
+        if(remaining == 0){
+            return;
+        }
+        Task* task = find_task(worker);
+        if(task != nullptr){
+            execute(task);
+            spins = 0;
+        }else if(++spins < spins_before_sleep){
+            std::this_thread::yield();
+        }else{
+            // the remaining tasks run elsewhere, sleep until the counter changes
+            futex_wait_for(&counter, remaining, wait_timeout_in_ns);
+        }
+    }
+}
+
+/**
+ * @name: run_worker()
+ * @brief: main loop of a worker thread
+ * @param index: index of the worker
+ */
+void ThreadPool::run_worker(unsigned int index)
+{
+    current_pool = this;
+    current_index = index;
+    Worker* worker = workers_[index].get();
+    while(true){
+        Task* task = find_task(worker);
+        for(unsigned int round = 0; task == nullptr && round < steal_rounds_before_park_; round++){
+            if(stop_.load(std::memory_order_acquire)){
+                return;
+            }
+            std::this_thread::yield();
+            task = find_task(worker);
+        }
+        if(task != nullptr){
+            execute(task);
+            continue;
+        }
+
+        // park: announce, re-check, then sleep unless the epoch moved
+        const uint32_t epoch = epoch_.load(std::memory_order_acquire);
+        num_sleeping_.fetch_add(1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(!has_work() && !stop_.load(std::memory_order_acquire)){
+            futex_wait(&epoch_, epoch);
+        }
+        num_sleeping_.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * @file    : ThreadRecords.cpp
+ * @brief   : Cpp file of per-thread records of memory reclamation domains
+ * @author  : David Blickenstorfer
+ *
+ * @date 19/10/2026
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#include "../include/ThreadRecords.hpp"
+#include "../include/concurrency_utils.hpp"
+#include <atomic>       //< for the domain id counter
+#include <algorithm>    //< for std::remove_if
+
+/**
+ * @name: get_domains()
+ * @brief: return the registry of the ids of all living domains, its mutex is
+ * held while a record is released so the domain cannot be destroyed meanwhile
+ */
+static ObjectRegistry<uint64_t>& get_domains()
+{
+    static ObjectRegistry<uint64_t> domains;
+    return domains;
+}
+
+/**
+ * @name: get_local()
+ * @brief: return the records of the calling thread
+ */
+ThreadRecords& ThreadRecords::get_local()
+{
+    static thread_local ThreadRecords records;
+    return records;
+}
+
+/**
+ * @name: ~ThreadRecords()
+ * @brief: Destructor, release the records of living domains
+ */
+ThreadRecords::~ThreadRecords()
+{
+    ObjectRegistry<uint64_t>& domains = get_domains();
+    std::lock_guard<std::mutex> guard(domains.get_mutex());
+    for(Entry& entry : entries_){
+        if(domains.contains(entry.id)){
+            entry.release(entry.domain, entry.record);
+        }
+    }
+}
+
+/**
+ * @name: add_domain()
+ * @brief: register a new domain
+ * @return: uint64_t, unique id of the domain
+ */
+uint64_t ThreadRecords::add_domain()
+{
+    static std::atomic<uint64_t> next_id(0);
+    const uint64_t id = next_id.fetch_add(1, std::memory_order_relaxed);
+    get_domains().add(id);
+    return id;
+}
+
+/**
+ * @name: remove_domain()
+ * @brief: unregister a domain, waits for exiting threads releasing a
+ * record, afterwards the domain may free its records
+ * @param id: id of the domain
+ */
+void ThreadRecords::remove_domain(uint64_t id)
+{
+    get_domains().remove(id);
+}
+
+/**
+ * @name: get()
+ * @brief: return the record of the calling thread in a domain, claim it
+ * on first use
+ * @param domain: pointer to the domain
+ * @param id: id of the domain
+ * @param claim: claims a record of the domain for the calling thread
+ * @param release: hands the record back when the thread exits
+ * @return: void*, record owned by the calling thread
+ */
+void* ThreadRecords::get(void* domain, uint64_t id, Claim claim, Release release)
+{
+    std::vector<Entry>& entries = get_local().entries_;
+    for(const Entry& entry : entries){
+        if(entry.domain == domain && entry.id == id){
+            return entry.record;
+        }
+    }
+
+    ObjectRegistry<uint64_t>& domains = get_domains();
+    std::lock_guard<std::mutex> guard(domains.get_mutex());
+    // forget the records of destroyed domains
+    entries.erase(std::remove_if(entries.begin(), entries.end(),
+                                 [&](const Entry& entry){ return !domains.contains(entry.id); }),
+                  entries.end());
+
+    void* record = claim(domain);
+    entries.push_back({domain, id, record, release});
+    return record;
+}
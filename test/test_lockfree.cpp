@@ -0,0 +1,1244 @@
+/**
+ * @file    : test_lockfree.cpp
+ * @brief   : test code of lock-free data structures
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026 (LockFreeStack)
+ * @date 18/10/2026 (AtomicPrimitives)
+ * @date 18/10/2026 (SpscRingBuffer)
+ * @date 18/10/2026 (MpmcQueue)
+ * @date 18/10/2026 (MpscQueue)
+ * @date 18/10/2026 (WorkStealingDeque)
+ * @date 18/10/2026 (EpochDomain)
+ * @date 19/10/2026 (HazardPointers, HazardStack, HazardQueue)
+ * @date 19/10/2026 (ShardedCounter)
+ * @date 19/10/2026 (PerCpuCounter, PerCpuFreeList)
+ * @date 19/10/2026 (ConcurrentHashMap)
+ * @date 19/10/2026 (SkipList)
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include "doctest.h"
+#include "../include/LockFreeStack.hpp"
+#include "../include/AtomicPrimitives.hpp"
+#include "../include/SpscRingBuffer.hpp"
+#include "../include/MpmcQueue.hpp"
+#include "../include/MpscQueue.hpp"
+#include "../include/WorkStealingDeque.hpp"
+#include "../include/EpochDomain.hpp"
+#include "../include/HazardPointers.hpp"
+#include "../include/HazardStack.hpp"
+#include "../include/HazardQueue.hpp"
+#include "../include/ShardedCounter.hpp"
+#include "../include/PerCpuCounter.hpp"
+#include "../include/PerCpuFreeList.hpp"
+#include "../include/ConcurrentHashMap.hpp"
+#include "../include/AtomicLock.hpp"
+#include "../include/SkipList.hpp"
+
+#include <thread>
+#include <vector>
+#include <string>
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+
+/**
+ * @brief test function for LockFreeStack<T>
+ */
+TEST_SUITE("LockFreeStack"){
+    //< Test pop after initialization
+    TEST_CASE("Pop after initialization"){
+        LockFreeStack<int> stack(4);
+        int value = 7;
+        CHECK(stack.empty());
+        CHECK(stack.pop(value) == false);
+        CHECK(value == 7);
+    }
+    //< Test LIFO order
+    TEST_CASE("LIFO order"){
+        LockFreeStack<std::string> stack(3);
+        CHECK(stack.push("a"));
+        CHECK(stack.push("b"));
+        std::string value;
+        CHECK(stack.pop(value));
+        CHECK(value == "b");
+        CHECK(stack.push("c"));
+        CHECK(stack.pop(value));
+        CHECK(value == "c");
+        CHECK(stack.pop(value));
+        CHECK(value == "a");
+        CHECK(stack.empty());
+    }
+    //< Test exhausted node pool and reuse of nodes
+    TEST_CASE("Capacity"){
+        LockFreeStack<int> stack(2);
+        CHECK(stack.get_capacity() == 2);
+        CHECK(stack.push(1));
+        CHECK(stack.push(2));
+        CHECK(stack.push(3) == false);
+        int value;
+        CHECK(stack.pop(value));
+        CHECK(stack.push(3));
+        LockFreeStack<int> empty_pool(0);
+        CHECK(empty_pool.push(1) == false);
+        CHECK_THROWS_AS(LockFreeStack<int>{0xFFFFFFFFu}, std::invalid_argument);
+    }
+    //< Test no value is lost or duplicated under concurrent push and pop
+    TEST_CASE("Concurrent push and pop"){
+        const unsigned int num_threads = 4;
+        const int per_thread = 20000;
+        LockFreeStack<int> stack(64);
+        std::vector<std::vector<int>> popped(num_threads);
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&, t](){
+                int value;
+                for(int i = 0; i < per_thread; i++){
+                    while(!stack.push(int(t) * per_thread + i)){
+                        if(stack.pop(value)){
+                            popped[t].push_back(value);
+                        }
+                    }
+                    if(i % 2 == 1 && stack.pop(value)){
+                        popped[t].push_back(value);
+                    }
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        std::vector<int> all;
+        for(const auto& values : popped){
+            all.insert(all.end(), values.begin(), values.end());
+        }
+        int value;
+        while(stack.pop(value)){
+            all.push_back(value);
+        }
+        std::sort(all.begin(), all.end());
+        REQUIRE(all.size() == num_threads * per_thread);
+        for(unsigned int i = 0; i < all.size(); i++){
+            if(all[i] != int(i)){
+                FAIL("value lost or duplicated: ", i);
+            }
+        }
+    }
+}
+
+/**
+ * @brief test function for the atomic primitives
+ */
+TEST_SUITE("AtomicPrimitives"){
+    //< Test strong and weak CAS
+    TEST_CASE("CAS"){
+        long value = 5;
+        long expected = 4;
+        CHECK(atomic_cas(&value, expected, 6l, std::memory_order_acq_rel) == false);
+        CHECK(expected == 5);
+        CHECK(atomic_cas(&value, expected, 6l, std::memory_order_acq_rel));
+        CHECK(value == 6);
+        expected = 6;
+        while(!atomic_cas_weak(&value, expected, 7l, std::memory_order_release, std::memory_order_relaxed)){
+        }
+        CHECK(atomic_load(&value, std::memory_order_acquire) == 7);
+    }
+    //< Test test-and-set and clear
+    TEST_CASE("TAS"){
+        bool flag = false;
+        CHECK(atomic_tas(&flag, std::memory_order_acquire) == false);
+        CHECK(atomic_tas(&flag, std::memory_order_acquire) == true);
+        atomic_clear(&flag, std::memory_order_release);
+        CHECK(flag == false);
+    }
+    //< Test fetch operations
+    TEST_CASE("Fetch operations"){
+        unsigned int value = 0b1100;
+        CHECK(atomic_fetch_add(&value, 1u, std::memory_order_relaxed) == 0b1100);
+        CHECK(atomic_fetch_sub(&value, 1u, std::memory_order_relaxed) == 0b1101);
+        CHECK(atomic_fetch_or(&value, 0b0011u) == 0b1100);
+        CHECK(atomic_fetch_and(&value, 0b0110u) == 0b1111);
+        CHECK(atomic_fetch_xor(&value, 0b0110u) == 0b0110);
+        CHECK(atomic_exchange(&value, 9u) == 0);
+        atomic_store(&value, 3u, std::memory_order_release);
+        CHECK(value == 3);
+    }
+    //< Test failure order derivation
+    TEST_CASE("Failure order"){
+        CHECK(get_failure_order(std::memory_order_acq_rel) == std::memory_order_acquire);
+        CHECK(get_failure_order(std::memory_order_release) == std::memory_order_relaxed);
+        CHECK(get_failure_order(std::memory_order_seq_cst) == std::memory_order_seq_cst);
+        CHECK(get_success_order(std::memory_order_release, std::memory_order_acquire) == std::memory_order_acq_rel);
+        CHECK(get_success_order(std::memory_order_relaxed, std::memory_order_acquire) == std::memory_order_acquire);
+        CHECK(get_success_order(std::memory_order_acquire, std::memory_order_seq_cst) == std::memory_order_seq_cst);
+        CHECK(get_success_order(std::memory_order_release, std::memory_order_relaxed) == std::memory_order_release);
+        CHECK(get_success_order(std::memory_order_relaxed, std::memory_order_release) == std::memory_order_relaxed);
+        CHECK(get_success_order(std::memory_order_release, std::memory_order_acq_rel) == std::memory_order_acq_rel);
+    }
+    //< Test DWCAS success and failure
+    TEST_CASE("DWCAS"){
+        DoubleWord value = {1, 2};
+        DoubleWord expected = {1, 3};
+        CHECK(dwcas(&value, expected, DoubleWord{4, 5}) == false);
+        CHECK(expected == DoubleWord{1, 2});
+        CHECK(dwcas(&value, expected, DoubleWord{4, 5}));
+        CHECK(dw_load(&value) == DoubleWord{4, 5});
+        // emulation has the same semantics
+        CHECK(dwcas_locked(&value, expected, DoubleWord{6, 7}) == false);
+        CHECK(expected == DoubleWord{4, 5});
+        CHECK(dwcas_locked(&value, expected, DoubleWord{6, 7}));
+        CHECK(value == DoubleWord{6, 7});
+    }
+    //< Test both words are updated together under contention
+    TEST_CASE("Concurrent DWCAS"){
+        DoubleWord value = {0, 0};
+        std::atomic<unsigned int> torn(0);
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < 4; t++){
+            threads.emplace_back([&](){
+                for(unsigned int i = 0; i < 20000; i++){
+                    DoubleWord expected = dw_load(&value);
+                    if(expected.low != expected.high){
+                        torn++;
+                    }
+                    while(!dwcas(&value, expected, DoubleWord{expected.low + 1, expected.high + 1})){
+                    }
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        CHECK(torn.load() == 0);
+        CHECK(value == DoubleWord{80000, 80000});
+    }
+}
+
+/**
+ * @brief test function for SpscRingBuffer<T>
+ */
+TEST_SUITE("SpscRingBuffer"){
+    //< Test capacity is rounded up to a power of two
+    TEST_CASE("Capacity"){
+        CHECK(SpscRingBuffer<int>(1).get_capacity() == 1);
+        CHECK(SpscRingBuffer<int>(5).get_capacity() == 8);
+        CHECK(SpscRingBuffer<int>(64).get_capacity() == 64);
+    }
+    //< Test FIFO order, full and empty buffer
+    TEST_CASE("FIFO order"){
+        SpscRingBuffer<std::string> ring(2);
+        std::string value = "x";
+        CHECK(ring.empty());
+        CHECK(ring.pop(value) == false);
+        CHECK(value == "x");
+        CHECK(ring.push("a"));
+        CHECK(ring.push("b"));
+        CHECK(ring.push("c") == false);
+        CHECK(ring.size() == 2);
+        CHECK(ring.pop(value));
+        CHECK(value == "a");
+        CHECK(ring.push("c"));
+        CHECK(ring.pop(value));
+        CHECK(value == "b");
+        CHECK(ring.pop(value));
+        CHECK(value == "c");
+        CHECK(ring.empty());
+    }
+    //< Test batch operations are partial at the boundaries and wrap around
+    TEST_CASE("Batch operations"){
+        SpscRingBuffer<int> ring(4);
+        int input[6] = {0, 1, 2, 3, 4, 5};
+        int output[6] = {};
+        CHECK(ring.push(input, 3) == 3);
+        CHECK(ring.pop(output, 2) == 2);
+        CHECK(output[1] == 1);
+        // tail wraps around the end of the slots
+        CHECK(ring.push(input + 3, 3) == 3);
+        CHECK(ring.push(input, 6) == 0);
+        CHECK(ring.pop(output, 6) == 4);
+        CHECK(output[0] == 2);
+        CHECK(output[3] == 5);
+        CHECK(ring.pop(output, 6) == 0);
+    }
+    //< Test the consumer sees every value once and in order
+    TEST_CASE("Concurrent producer and consumer"){
+        const unsigned int num_values = 200000;
+        SpscRingBuffer<unsigned int> ring(128);
+        std::thread producer([&](){
+            unsigned int batch[16];
+            unsigned int next = 0;
+            while(next < num_values){
+                if(next % 3 == 0){
+                    if(ring.push(next)){
+                        next++;
+                        continue;
+                    }
+                }else{
+                    unsigned int count = std::min(16u, num_values - next);
+                    for(unsigned int i = 0; i < count; i++){
+                        batch[i] = next + i;
+                    }
+                    const std::size_t pushed = ring.push(batch, count);
+                    next += pushed;
+                    if(pushed > 0){
+                        continue;
+                    }
+                }
+                std::this_thread::yield();
+            }
+        });
+        unsigned int expected = 0;
+        unsigned int errors = 0;
+        unsigned int batch[8];
+        while(expected < num_values){
+            const std::size_t popped = ring.pop(batch, 8);
+            if(popped == 0){
+                std::this_thread::yield();
+            }
+            for(std::size_t i = 0; i < popped; i++){
+                if(batch[i] != expected++){
+                    errors++;
+                }
+            }
+        }
+        producer.join();
+        CHECK(errors == 0);
+        CHECK(ring.empty());
+    }
+}
+
+/**
+ * @brief test function for MpmcQueue<T>
+ */
+TEST_SUITE("MpmcQueue"){
+    //< Test capacity is rounded up to a power of two of at least 2
+    TEST_CASE("Capacity"){
+        CHECK(MpmcQueue<int>(1).get_capacity() == 2);
+        CHECK(MpmcQueue<int>(100).get_capacity() == 128);
+    }
+    //< Test FIFO order, full and empty queue
+    TEST_CASE("FIFO order"){
+        MpmcQueue<std::string> queue(2);
+        std::string value = "x";
+        CHECK(queue.empty());
+        CHECK(queue.try_pop(value) == false);
+        CHECK(value == "x");
+        CHECK(queue.try_push("a"));
+        CHECK(queue.try_push("b"));
+        CHECK(queue.try_push("c") == false);
+        CHECK(queue.size() == 2);
+        CHECK(queue.try_pop(value));
+        CHECK(value == "a");
+        queue.push("c");
+        CHECK(queue.pop() == "b");
+        CHECK(queue.pop() == "c");
+        CHECK(queue.empty());
+    }
+    //< Test no value is lost or duplicated and each producer's values stay in order
+    TEST_CASE("Concurrent producers and consumers"){
+        const unsigned int num_producers = 3;
+        const unsigned int num_consumers = 3;
+        const unsigned int per_producer = 30000;
+        MpmcQueue<unsigned int> queue(16);
+        std::vector<std::vector<unsigned int>> popped(num_consumers);
+        std::vector<std::thread> threads;
+        for(unsigned int p = 0; p < num_producers; p++){
+            threads.emplace_back([&, p](){
+                for(unsigned int i = 0; i < per_producer; i++){
+                    queue.push(p * per_producer + i);
+                }
+            });
+        }
+        for(unsigned int c = 0; c < num_consumers; c++){
+            threads.emplace_back([&, c](){
+                for(unsigned int i = 0; i < per_producer; i++){
+                    popped[c].push_back(queue.pop());
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        unsigned int out_of_order = 0;
+        std::vector<unsigned int> all;
+        for(const auto& values : popped){
+            std::vector<unsigned int> last(num_producers, 0);
+            for(unsigned int value : values){
+                const unsigned int producer = value / per_producer;
+                if(value % per_producer < last[producer]){
+                    out_of_order++;
+                }
+                last[producer] = value % per_producer;
+            }
+            all.insert(all.end(), values.begin(), values.end());
+        }
+        CHECK(out_of_order == 0);
+        std::sort(all.begin(), all.end());
+        REQUIRE(all.size() == num_producers * per_producer);
+        for(unsigned int i = 0; i < all.size(); i++){
+            if(all[i] != i){
+                FAIL("value lost or duplicated: ", i);
+            }
+        }
+        CHECK(queue.empty());
+    }
+}
+
+/**
+ * @brief record of the MpscQueue tests
+ */
+struct Record : MpscNode{
+    unsigned int value = 0;
+};
+
+/**
+ * @brief test function for MpscQueue<T>
+ */
+TEST_SUITE("MpscQueue"){
+    //< Test FIFO order and reuse of popped records
+    TEST_CASE("FIFO order"){
+        MpscQueue<Record> queue;
+        Record records[3];
+        for(unsigned int i = 0; i < 3; i++){
+            records[i].value = i;
+        }
+        CHECK(queue.empty());
+        CHECK(queue.pop() == nullptr);
+        queue.push(&records[0]);
+        queue.push(&records[1]);
+        CHECK(queue.empty() == false);
+        CHECK(queue.pop() == &records[0]);
+        queue.push(&records[2]);
+        CHECK(queue.pop() == &records[1]);
+        CHECK(queue.pop() == &records[2]);
+        CHECK(queue.pop() == nullptr);
+        CHECK(queue.empty());
+        // the popped record can be pushed again
+        queue.push(&records[0]);
+        CHECK(queue.pop() == &records[0]);
+        CHECK(queue.empty());
+    }
+    //< Test drain stops at max_count
+    TEST_CASE("Drain"){
+        MpscQueue<Record> queue;
+        Record records[5];
+        for(unsigned int i = 0; i < 5; i++){
+            records[i].value = i;
+            queue.push(&records[i]);
+        }
+        std::vector<unsigned int> values;
+        CHECK(queue.drain([&](Record* record){ values.push_back(record->value); }, 2) == 2);
+        CHECK(queue.drain([&](Record* record){ values.push_back(record->value); }) == 3);
+        CHECK(values == std::vector<unsigned int>{0, 1, 2, 3, 4});
+        CHECK(queue.drain([&](Record*){}) == 0);
+    }
+    //< Test the consumer receives every record once and each producer's records in order
+    TEST_CASE("Concurrent producers"){
+        const unsigned int num_producers = 4;
+        const unsigned int per_producer = 20000;
+        MpscQueue<Record> queue;
+        std::vector<Record> records(num_producers * per_producer);
+        std::vector<std::thread> producers;
+        for(unsigned int p = 0; p < num_producers; p++){
+            producers.emplace_back([&, p](){
+                for(unsigned int i = 0; i < per_producer; i++){
+                    Record& record = records[p * per_producer + i];
+                    record.value = p * per_producer + i;
+                    queue.push(&record);
+                }
+            });
+        }
+        std::vector<unsigned int> next(num_producers, 0);
+        unsigned int received = 0;
+        unsigned int errors = 0;
+        while(received < num_producers * per_producer){
+            const std::size_t count = queue.drain([&](Record* record){
+                const unsigned int producer = record->value / per_producer;
+                if(record->value % per_producer != next[producer]++){
+                    errors++;
+                }
+            }, 64);
+            received += count;
+            if(count == 0){
+                std::this_thread::yield();
+            }
+        }
+        for(auto& producer : producers){
+            producer.join();
+        }
+        CHECK(errors == 0);
+        CHECK(queue.empty());
+    }
+}
+
+/**
+ * @brief test function for WorkStealingDeque<T>
+ */
+TEST_SUITE("WorkStealingDeque"){
+    //< Test owner pops newest first, thieves steal oldest first
+    TEST_CASE("Order"){
+        WorkStealingDeque<int> deque(4);
+        int value = -1;
+        CHECK(deque.empty());
+        CHECK(deque.pop(value) == false);
+        CHECK(deque.steal(value) == false);
+        CHECK(value == -1);
+        for(int i = 0; i < 4; i++){
+            deque.push(i);
+        }
+        CHECK(deque.size() == 4);
+        CHECK(deque.pop(value));
+        CHECK(value == 3);
+        CHECK(deque.steal(value));
+        CHECK(value == 0);
+        CHECK(deque.pop(value));
+        CHECK(value == 2);
+        CHECK(deque.pop(value));
+        CHECK(value == 1);
+        CHECK(deque.pop(value) == false);
+        CHECK(deque.empty());
+    }
+    //< Test the array grows and keeps the elements
+    TEST_CASE("Growth"){
+        WorkStealingDeque<int> deque(2);
+        CHECK(deque.get_capacity() == 2);
+        for(int i = 0; i < 100; i++){
+            deque.push(i);
+        }
+        CHECK(deque.get_capacity() == 128);
+        int value;
+        for(int i = 0; i < 50; i++){
+            CHECK(deque.steal(value));
+            CHECK(value == i);
+        }
+        for(int i = 99; i >= 50; i--){
+            CHECK(deque.pop(value));
+            CHECK(value == i);
+        }
+    }
+    //< Test every element is taken exactly once by the owner or a thief
+    TEST_CASE("Concurrent pop and steal"){
+        const unsigned int num_thieves = 3;
+        const int num_values = 100000;
+        WorkStealingDeque<int> deque(8);
+        std::atomic<bool> done(false);
+        std::vector<std::vector<int>> taken(num_thieves + 1);
+        std::vector<std::thread> thieves;
+        for(unsigned int t = 0; t < num_thieves; t++){
+            thieves.emplace_back([&, t](){
+                int value;
+                while(!done.load() || !deque.empty()){
+                    if(deque.steal(value)){
+                        taken[t].push_back(value);
+                    }else{
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        int value;
+        for(int i = 0; i < num_values; i++){
+            deque.push(i);
+            if(i % 3 == 0 && deque.pop(value)){
+                taken[num_thieves].push_back(value);
+            }
+        }
+        while(deque.pop(value)){
+            taken[num_thieves].push_back(value);
+        }
+        done = true;
+        for(auto& thief : thieves){
+            thief.join();
+        }
+        std::vector<int> all;
+        for(const auto& values : taken){
+            all.insert(all.end(), values.begin(), values.end());
+        }
+        std::sort(all.begin(), all.end());
+        REQUIRE(all.size() == std::size_t(num_values));
+        for(int i = 0; i < num_values; i++){
+            if(all[i] != i){
+                FAIL("value lost or duplicated: ", i);
+            }
+        }
+    }
+}
+
+/**
+ * @brief node counting its destructions for the reclamation tests
+ */
+struct Tracked{
+    static std::atomic<int> num_destroyed;
+    int value;
+    bool alive;
+    explicit Tracked(int value) : value(value), alive(true) {}
+    ~Tracked() { alive = false; num_destroyed++; }
+};
+std::atomic<int> Tracked::num_destroyed(0);
+
+TEST_SUITE("EpochDomain"){
+    //< Test a node is not freed while a guard entered before its retirement is active
+    TEST_CASE("Deferred free"){
+        Tracked::num_destroyed = 0;
+        EpochDomain domain(1);
+        std::atomic<int> state(0);
+        std::thread reader([&](){
+            EpochDomain::Guard guard(domain);
+            state = 1;
+            while(state.load() != 2){
+                std::this_thread::yield();
+            }
+        });
+        while(state.load() != 1){
+            std::this_thread::yield();
+        }
+        domain.retire(new Tracked(1));
+        for(int i = 0; i < 10; i++){
+            domain.collect();
+        }
+        CHECK(Tracked::num_destroyed == 0);
+        CHECK(domain.get_num_pending() == 1);
+        state = 2;
+        reader.join();
+        for(int i = 0; i < 3; i++){
+            domain.collect();
+        }
+        CHECK(Tracked::num_destroyed == 1);
+        CHECK(domain.get_num_pending() == 0);
+        CHECK(domain.get_num_freed() == 1);
+    }
+    //< Test nested guards of one thread and retirement inside a guard
+    TEST_CASE("Nested guards"){
+        Tracked::num_destroyed = 0;
+        EpochDomain domain(1);
+        {
+            EpochDomain::Guard outer(domain);
+            {
+                EpochDomain::Guard inner(domain);
+                inner.retire(new Tracked(1));
+            }
+            // the outer guard still pins the epoch of the retirement
+            for(int i = 0; i < 5; i++){
+                domain.collect();
+            }
+            CHECK(Tracked::num_destroyed == 0);
+        }
+        for(int i = 0; i < 3; i++){
+            domain.collect();
+        }
+        CHECK(Tracked::num_destroyed == 1);
+    }
+    //< Test the destructor frees the pending nodes, also of exited threads
+    TEST_CASE("Destructor"){
+        Tracked::num_destroyed = 0;
+        {
+            EpochDomain domain;
+            for(int i = 0; i < 10; i++){
+                domain.retire(new Tracked(i));
+            }
+            std::thread([&](){ domain.retire(new Tracked(10)); }).join();
+            CHECK(Tracked::num_destroyed == 0);
+        }
+        CHECK(Tracked::num_destroyed == 11);
+    }
+    //< Test readers never see a freed node while writers swap and retire it
+    TEST_CASE("Concurrent swap"){
+        const unsigned int num_readers = 3;
+        const int num_swaps = 20000;
+        Tracked::num_destroyed = 0;
+        {
+            EpochDomain domain(16);
+            std::atomic<Tracked*> shared(new Tracked(0));
+            std::atomic<bool> done(false);
+            std::atomic<int> num_errors(0);
+            std::vector<std::thread> readers;
+            for(unsigned int t = 0; t < num_readers; t++){
+                readers.emplace_back([&](){
+                    while(!done.load()){
+                        EpochDomain::Guard guard(domain);
+                        const Tracked* node = shared.load(std::memory_order_acquire);
+                        if(!node->alive || node->value < 0){
+                            num_errors++;
+                        }
+                    }
+                });
+            }
+            for(int i = 1; i <= num_swaps; i++){
+                Tracked* old = shared.exchange(new Tracked(i));
+                domain.retire(old);
+            }
+            done = true;
+            for(auto& reader : readers){
+                reader.join();
+            }
+            CHECK(num_errors == 0);
+            CHECK(std::size_t(Tracked::num_destroyed) + domain.get_num_pending() == std::size_t(num_swaps));
+            // a reader preempted inside its guard may have blocked all frees so far
+            for(int i = 0; i < 3; i++){
+                domain.collect();
+            }
+            CHECK(Tracked::num_destroyed == num_swaps);
+            delete shared.load();
+        }
+        CHECK(Tracked::num_destroyed == num_swaps + 1);
+    }
+}
+
+TEST_SUITE("HazardPointers"){
+    //< Test a protected node survives scans until the hazard is reset
+    TEST_CASE("Protection"){
+        Tracked::num_destroyed = 0;
+        HazardDomain domain(1);
+        std::atomic<Tracked*> shared(new Tracked(1));
+        std::atomic<int> state(0);
+        std::thread reader([&](){
+            HazardDomain::Hazard hazard(domain);
+            Tracked* node = hazard.protect(shared);
+            state = 1;
+            while(state.load() != 2){
+                std::this_thread::yield();
+            }
+            CHECK(node->alive);
+            hazard.reset();
+            state = 3;
+            while(state.load() != 4){
+                std::this_thread::yield();
+            }
+        });
+        while(state.load() != 1){
+            std::this_thread::yield();
+        }
+        domain.retire(shared.exchange(nullptr));
+        domain.scan();
+        CHECK(Tracked::num_destroyed == 0);
+        CHECK(domain.get_num_pending() == 1);
+        state = 2;
+        while(state.load() != 3){
+            std::this_thread::yield();
+        }
+        domain.scan();
+        CHECK(Tracked::num_destroyed == 1);
+        CHECK(domain.get_num_pending() == 0);
+        state = 4;
+        reader.join();
+    }
+    //< Test the retire list stays bounded by the threshold while a reader is stalled
+    TEST_CASE("Bounded memory"){
+        Tracked::num_destroyed = 0;
+        HazardDomain domain(16);
+        std::atomic<Tracked*> shared(new Tracked(0));
+        std::atomic<int> state(0);
+        std::thread stalled([&](){
+            HazardDomain::Hazard hazard(domain);
+            hazard.protect(shared);
+            state = 1;
+            while(state.load() != 2){
+                std::this_thread::yield();
+            }
+        });
+        while(state.load() != 1){
+            std::this_thread::yield();
+        }
+        uint64_t max_pending = 0;
+        for(int i = 1; i <= 10000; i++){
+            domain.retire(shared.exchange(new Tracked(i)));
+            max_pending = std::max(max_pending, domain.get_num_pending());
+        }
+        CHECK(max_pending <= domain.get_retire_threshold());
+        state = 2;
+        stalled.join();
+        delete shared.load();
+    }
+    //< Test the slots of a thread are limited and given back
+    TEST_CASE("Slots"){
+        HazardDomain domain;
+        {
+            HazardDomain::Hazard hazards[HazardDomain::max_slots] = {
+                HazardDomain::Hazard(domain), HazardDomain::Hazard(domain),
+                HazardDomain::Hazard(domain), HazardDomain::Hazard(domain)};
+            CHECK_THROWS(HazardDomain::Hazard{domain});
+        }
+        CHECK_NOTHROW(HazardDomain::Hazard{domain});
+    }
+    //< Test the stack order and that no value is lost or duplicated under concurrency
+    TEST_CASE("HazardStack"){
+        HazardDomain domain;
+        HazardStack<int> stack(domain);
+        int value = -1;
+        CHECK(stack.pop(value) == false);
+        CHECK(stack.empty());
+        stack.push(1);
+        stack.push(2);
+        CHECK(stack.pop(value));
+        CHECK(value == 2);
+        CHECK(stack.pop(value));
+        CHECK(value == 1);
+        CHECK(stack.empty());
+
+        const unsigned int num_threads = 4;
+        const int values_per_thread = 20000;
+        std::vector<std::vector<int>> popped(num_threads);
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&, t](){
+                int value;
+                for(int i = 0; i < values_per_thread; i++){
+                    stack.push(int(t) * values_per_thread + i);
+                    if(stack.pop(value)){
+                        popped[t].push_back(value);
+                    }
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        std::vector<int> all;
+        for(const auto& values : popped){
+            all.insert(all.end(), values.begin(), values.end());
+        }
+        while(stack.pop(value)){
+            all.push_back(value);
+        }
+        std::sort(all.begin(), all.end());
+        REQUIRE(all.size() == std::size_t(num_threads) * values_per_thread);
+        for(std::size_t i = 0; i < all.size(); i++){
+            if(all[i] != int(i)){
+                FAIL("value lost or duplicated: ", i);
+            }
+        }
+    }
+    //< Test the queue order and that each producer's values stay in order under concurrency
+    TEST_CASE("HazardQueue"){
+        HazardDomain domain;
+        HazardQueue<int> queue(domain);
+        int value = -1;
+        CHECK(queue.pop(value) == false);
+        CHECK(queue.empty());
+        queue.push(1);
+        queue.push(2);
+        CHECK(queue.pop(value));
+        CHECK(value == 1);
+        CHECK(queue.pop(value));
+        CHECK(value == 2);
+        CHECK(queue.empty());
+
+        const unsigned int num_producers = 2;
+        const unsigned int num_consumers = 2;
+        const int values_per_producer = 20000;
+        std::atomic<int> num_popped(0);
+        std::vector<std::vector<int>> popped(num_consumers);
+        std::vector<std::thread> threads;
+        for(unsigned int p = 0; p < num_producers; p++){
+            threads.emplace_back([&, p](){
+                for(int i = 0; i < values_per_producer; i++){
+                    queue.push(int(p) * values_per_producer + i);
+                }
+            });
+        }
+        for(unsigned int c = 0; c < num_consumers; c++){
+            threads.emplace_back([&, c](){
+                int value;
+                while(num_popped.load() < int(num_producers) * values_per_producer){
+                    if(queue.pop(value)){
+                        popped[c].push_back(value);
+                        num_popped++;
+                    }else{
+                        std::this_thread::yield();
+                    }
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        std::vector<int> all;
+        for(const auto& values : popped){
+            // values of one producer leave the queue in push order
+            std::vector<int> last(num_producers, -1);
+            for(int v : values){
+                const unsigned int p = v / values_per_producer;
+                if(v <= last[p]){
+                    FAIL("values of producer ", p, " out of order");
+                }
+                last[p] = v;
+            }
+            all.insert(all.end(), values.begin(), values.end());
+        }
+        std::sort(all.begin(), all.end());
+        REQUIRE(all.size() == std::size_t(num_producers) * values_per_producer);
+        for(std::size_t i = 0; i < all.size(); i++){
+            if(all[i] != int(i)){
+                FAIL("value lost or duplicated: ", i);
+            }
+        }
+    }
+}
+
+TEST_SUITE("ShardedCounter"){
+    //< Test the number of cells and the aggregate of one thread
+    TEST_CASE("Single thread"){
+        ShardedCounter<long> counter(5);
+        CHECK(counter.get_num_cells() == 8);
+        CHECK(counter.get() == 0);
+        counter.increment();
+        counter.add(41);
+        counter.add(-2);
+        CHECK(counter.get() == 40);
+        CHECK(counter.reset() == 40);
+        CHECK(counter.get() == 0);
+    }
+    //< Test no add is lost with more threads than cells and concurrent resets
+    TEST_CASE("Concurrent add"){
+        const unsigned int num_threads = 6;
+        const long adds_per_thread = 100000;
+        ShardedCounter<long> counter(4);
+        std::atomic<bool> done(false);
+        long drained = 0;
+        std::thread reader([&](){
+            while(!done.load()){
+                drained += counter.reset();
+                std::this_thread::yield();
+            }
+        });
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&](){
+                for(long i = 0; i < adds_per_thread; i++){
+                    counter.increment();
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        done = true;
+        reader.join();
+        CHECK(drained + counter.get() == num_threads * adds_per_thread);
+    }
+}
+
+/**
+ * @brief free block for the per-CPU free list tests
+ */
+struct Block : PerCpuNode{
+    int id = 0;
+};
+
+TEST_SUITE("PerCpu"){
+    //< Test no add is lost, with rseq the sequences are restarted on preemption
+    TEST_CASE("PerCpuCounter"){
+        const unsigned int num_threads = 4;
+        const long adds_per_thread = 200000;
+        PerCpuCounter counter;
+        CHECK(counter.get() == 0);
+        counter.add(5);
+        counter.add(-2);
+        CHECK(counter.get() == 3);
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&](){
+                for(long i = 0; i < adds_per_thread; i++){
+                    counter.increment();
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        CHECK(counter.get() == 3 + num_threads * adds_per_thread);
+    }
+    //< Test every node is popped or flushed exactly once
+    TEST_CASE("PerCpuFreeList"){
+        const unsigned int num_threads = 4;
+        const int blocks_per_thread = 1000;
+        const int rounds = 50;
+        std::vector<Block> blocks(num_threads * blocks_per_thread);
+        for(std::size_t i = 0; i < blocks.size(); i++){
+            blocks[i].id = int(i);
+        }
+        PerCpuFreeList<Block> list;
+        CHECK(list.pop() == nullptr);
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < num_threads; t++){
+            threads.emplace_back([&, t](){
+                // the thread owns its blocks while they are not in the list
+                std::vector<Block*> owned;
+                for(int i = 0; i < blocks_per_thread; i++){
+                    owned.push_back(&blocks[t * blocks_per_thread + i]);
+                }
+                for(int r = 0; r < rounds; r++){
+                    for(Block* block : owned){
+                        list.push(block);
+                    }
+                    owned.clear();
+                    for(int i = 0; i < blocks_per_thread; i++){
+                        Block* block = list.pop();
+                        if(block != nullptr){
+                            owned.push_back(block);
+                        }
+                    }
+                }
+                for(Block* block : owned){
+                    list.push(block);
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        std::vector<int> ids;
+        const std::size_t count = list.flush([&](Block* block){ ids.push_back(block->id); });
+        CHECK(count == blocks.size());
+        std::sort(ids.begin(), ids.end());
+        for(std::size_t i = 0; i < ids.size(); i++){
+            if(ids[i] != int(i)){
+                FAIL("block lost or duplicated: ", i);
+            }
+        }
+        CHECK(list.pop() == nullptr);
+    }
+}
+
+TEST_SUITE("ConcurrentHashMap"){
+    //< Test insert, assign, find and erase of one thread
+    TEST_CASE("Single thread"){
+        ConcurrentHashMap<int, long> map;
+        long value = -1;
+        CHECK(map.find(1, value) == false);
+        CHECK(value == -1);
+        CHECK(map.insert(1, 10));
+        CHECK(map.insert(1, 11) == false);
+        CHECK(map.find(1, value));
+        CHECK(value == 10);
+        CHECK(map.insert_or_assign(1, 12) == false);
+        CHECK(map.find(1, value));
+        CHECK(value == 12);
+        CHECK(map.size() == 1);
+        const ConcurrentHashMap<int, long>& readonly = map;
+        CHECK(readonly.contains(1));
+        CHECK(readonly.find(1, value));
+        CHECK(map.erase(1));
+        CHECK(map.erase(1) == false);
+        CHECK(readonly.contains(1) == false);
+        CHECK(map.size() == 0);
+    }
+    //< Test the segments grow and keep all keys, tombstones do not grow them
+    TEST_CASE("Growth and tombstones"){
+        ConcurrentHashMap<int, int, SpinLock, 4> map;
+        const std::size_t initial_capacity = map.get_capacity();
+        int num_inserted = 0;
+        for(int i = 0; i < 10000; i++){
+            num_inserted += map.insert(i, 2 * i) ? 1 : 0;
+        }
+        CHECK(num_inserted == 10000);
+        CHECK(map.size() == 10000);
+        CHECK(map.get_capacity() > initial_capacity);
+        for(int i = 0; i < 10000; i++){
+            int value = -1;
+            if(!map.find(i, value) || value != 2 * i){
+                FAIL("key lost: ", i);
+            }
+        }
+        for(int i = 0; i < 10000; i++){
+            map.erase(i);
+        }
+        const std::size_t capacity = map.get_capacity();
+        for(int i = 0; i < 100000; i++){
+            map.insert(i % 64, i);
+            map.erase(i % 64);
+        }
+        CHECK(map.size() == 0);
+        CHECK(map.get_capacity() == capacity);
+    }
+    //< Test readers only see complete values while writers insert, assign and erase
+    TEST_CASE_TEMPLATE("Concurrent readers and writers", Lock, SpinLock, AtomicLock){
+        // the value of a key is always a multiple of the key plus one
+        struct Pair{ long key; long multiple; };
+        const int num_keys = 512;
+        const unsigned int num_writers = 2;
+        const unsigned int num_readers = 2;
+        ConcurrentHashMap<int, Pair, Lock, 8> map;
+        std::atomic<bool> done(false);
+        std::atomic<int> num_errors(0);
+        std::vector<std::thread> threads;
+        for(unsigned int w = 0; w < num_writers; w++){
+            threads.emplace_back([&, w](){
+                for(int i = 0; i < 50000; i++){
+                    const int key = (i * 7 + int(w)) % num_keys;
+                    if(i % 3 == 0){
+                        map.erase(key);
+                    }else{
+                        map.insert_or_assign(key, Pair{key, long(i) * (key + 1)});
+                    }
+                }
+            });
+        }
+        for(unsigned int r = 0; r < num_readers; r++){
+            threads.emplace_back([&](){
+                int key = 0;
+                while(!done.load()){
+                    Pair pair;
+                    if(map.find(key, pair) && (pair.key != key || pair.multiple % (key + 1) != 0)){
+                        num_errors++;
+                    }
+                    key = (key + 1) % num_keys;
+                }
+            });
+        }
+        for(unsigned int w = 0; w < num_writers; w++){
+            threads[w].join();
+        }
+        done = true;
+        for(unsigned int r = 0; r < num_readers; r++){
+            threads[num_writers + r].join();
+        }
+        CHECK(num_errors == 0);
+        std::size_t count = 0;
+        for(int key = 0; key < num_keys; key++){
+            count += map.contains(key) ? 1 : 0;
+        }
+        CHECK(count == map.size());
+    }
+}
+
+//< value counting its constructions and destructions, also of the copies in nodes
+struct Counted{
+    static std::atomic<long> num_created;
+    static std::atomic<long> num_destroyed;
+    int value;
+    explicit Counted(int value) : value(value) { num_created++; }
+    Counted(const Counted& counted) : value(counted.value) { num_created++; }
+    ~Counted() { num_destroyed++; }
+};
+std::atomic<long> Counted::num_created(0);
+std::atomic<long> Counted::num_destroyed(0);
+
+TEST_SUITE("SkipList"){
+    //< Test insert, find, erase and the order of a range
+    TEST_CASE("Single thread"){
+        EpochDomain domain;
+        SkipList<int, std::string> list(domain);
+        std::string value;
+        CHECK(list.empty());
+        CHECK(list.find(1, value) == false);
+        for(int key : {5, 1, 9, 3, 7}){
+            CHECK(list.insert(key, std::to_string(key)));
+        }
+        CHECK(list.insert(3, "three") == false);
+        CHECK(list.find(3, value));
+        CHECK(value == "3");
+        CHECK(list.erase(3));
+        CHECK(list.erase(3) == false);
+        CHECK(list.contains(3) == false);
+        std::vector<int> keys;
+        CHECK(list.for_each(2, 9, [&](int key, const std::string&){ keys.push_back(key); }) == 2);
+        CHECK(keys == std::vector<int>{5, 7});
+        keys.clear();
+        list.for_each(0, 100, [&](int key, const std::string&){ keys.push_back(key); });
+        CHECK(keys == std::vector<int>{1, 5, 7, 9});
+        CHECK(list.empty() == false);
+    }
+    //< Test concurrent writers on shared keys against a per-key model and
+    //< readers seeing strictly ascending ranges
+    TEST_CASE("Concurrent insert, erase and range"){
+        const unsigned int num_writers = 4;
+        const int num_keys = 256;
+        const int ops_per_writer = 20000;
+        EpochDomain domain(16);
+        {
+            // the domain outlives the list, it frees the erased nodes
+            SkipList<int, int> list(domain);
+            // each key belongs to one writer, so the final state is known
+            std::vector<std::vector<char>> present(num_writers, std::vector<char>(num_keys, 0));
+            std::atomic<bool> done(false);
+            std::atomic<int> num_errors(0);
+            std::vector<std::thread> writers;
+            for(unsigned int w = 0; w < num_writers; w++){
+                writers.emplace_back([&, w](){
+                    unsigned int random = w + 1;
+                    for(int i = 0; i < ops_per_writer; i++){
+                        random = random * 1103515245u + 12345u;
+                        const int key = int((random >> 8) % (num_keys / num_writers)) * num_writers + w;
+                        if((random >> 24) & 1){
+                            if(list.insert(key, -key) == bool(present[w][key])){
+                                num_errors++;
+                            }
+                            present[w][key] = 1;
+                        }else{
+                            if(list.erase(key) != bool(present[w][key])){
+                                num_errors++;
+                            }
+                            present[w][key] = 0;
+                        }
+                    }
+                });
+            }
+            std::thread reader([&](){
+                while(!done.load()){
+                    int previous = -1;
+                    list.for_each(0, num_keys, [&](int key, int value){
+                        if(key <= previous || value != -key){
+                            num_errors++;
+                        }
+                        previous = key;
+                    });
+                }
+            });
+            for(auto& writer : writers){
+                writer.join();
+            }
+            done = true;
+            reader.join();
+            CHECK(num_errors == 0);
+            for(int key = 0; key < num_keys; key++){
+                if(list.contains(key) != bool(present[key % num_writers][key])){
+                    FAIL("wrong state of key ", key);
+                }
+            }
+        }
+    }
+    //< Test writers racing on the same few keys, every node is freed exactly once
+    TEST_CASE("Shared keys"){
+        const unsigned int num_writers = 4;
+        const int num_keys = 8;
+        const int ops_per_writer = 20000;
+        Counted::num_created = 0;
+        Counted::num_destroyed = 0;
+        std::atomic<long> num_inserted(0);
+        std::atomic<long> num_erased(0);
+        {
+            // the writers' retired nodes stay pending until the domain is destroyed
+            EpochDomain domain(16);
+            SkipList<int, Counted> list(domain);
+            std::vector<std::thread> writers;
+            for(unsigned int w = 0; w < num_writers; w++){
+                writers.emplace_back([&, w](){
+                    unsigned int random = w + 1;
+                    for(int i = 0; i < ops_per_writer; i++){
+                        random = random * 1103515245u + 12345u;
+                        const int key = int((random >> 8) % num_keys);
+                        if((random >> 24) & 1){
+                            num_inserted += list.insert(key, Counted(key)) ? 1 : 0;
+                        }else{
+                            num_erased += list.erase(key) ? 1 : 0;
+                        }
+                    }
+                });
+            }
+            for(auto& writer : writers){
+                writer.join();
+            }
+            for(int key = 0; key < num_keys; key++){
+                num_erased += list.erase(key) ? 1 : 0;
+            }
+            CHECK(list.empty());
+            CHECK(Counted::num_destroyed < Counted::num_created);
+        }
+        CHECK(num_inserted == num_erased);
+        CHECK(Counted::num_destroyed == Counted::num_created);
+    }
+}
@@ -0,0 +1,694 @@
+/**
+ * @file    : test_locks.cpp
+ * @brief   : test code of locks
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026 (SeqLock)
+ * @date 18/10/2026 (NumaTopology and CohortLock)
+ * @date 18/10/2026 (FutexLock)
+ * @date 18/10/2026 (Lockable interface)
+ * @date 18/10/2026 (InstrumentedLock)
+ * @date 18/10/2026 (StripedLock)
+ * @date 18/10/2026 (AdaptiveLock)
+ * @date 18/10/2026 (FlatCombiner)
+ * @date 19/10/2026 (DelegationLock)
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include "doctest.h"
+#include "../include/SeqLock.hpp"
+#include "../include/CohortLock.hpp"
+#include "../include/FutexLock.hpp"
+#include "../include/SpinLock.hpp"
+#include "../include/AtomicLock.hpp"
+#include "../include/InstrumentedLock.hpp"
+#include "../include/StripedLock.hpp"
+#include "../include/AdaptiveLock.hpp"
+#include "../include/FlatCombiner.hpp"
+#include "../include/DelegationLock.hpp"
+
+#include <thread>
+#include <vector>
+#include <fstream>
+#include <filesystem>
+#include <mutex>
+#include <condition_variable>
+#include <sstream>
+#include <queue>
+#include <stdexcept>
+
+/**
+ * @brief test payload, consistent if all entries are equal
+ */
+struct Snapshot{
+    unsigned long values[64];
+};
+
+/**
+ * @brief increment a shared counter under lock from several threads
+ * @return: counter after all threads finished, equals threads * iterations
+ */
+template <typename Lock>
+unsigned long count_under_lock(Lock& lock, unsigned int num_threads, unsigned long iterations)
+{
+    unsigned long counter = 0;
+    std::vector<std::thread> threads;
+    for(unsigned int t = 0; t < num_threads; t++){
+        threads.emplace_back([&](){
+            for(unsigned long i = 0; i < iterations; i++){
+                lock.acquire();
+                counter++;
+                lock.release();
+            }
+        });
+    }
+    for(auto& thread : threads){
+        thread.join();
+    }
+    return counter;
+}
+
+/**
+ * @brief create a sysfs-like node directory with the given cpulists
+ */
+std::string make_fake_sysfs(const std::string& name, const std::vector<std::string>& cpulists)
+{
+    const std::filesystem::path path = std::filesystem::temp_directory_path() / name;
+    std::filesystem::remove_all(path);
+    for(unsigned int node = 0; node < cpulists.size(); node++){
+        const std::filesystem::path node_path = path / ("node" + std::to_string(2 * node));
+        std::filesystem::create_directories(node_path);
+        std::ofstream(node_path / "cpulist") << cpulists[node] << "\n";
+    }
+    return path.string();
+}
+
+/**
+ * @brief test function for SeqLock<T>
+ */
+TEST_SUITE("SeqLock"){
+    //< Test value of default constructed SeqLock
+    TEST_CASE("Load after initialization"){
+        SeqLock<int> lock;
+        CHECK(lock.load() == 0);
+        CHECK(lock.get_version() == 0);
+    }
+    //< Test load after store
+    TEST_CASE("Load after store"){
+        SeqLock<Snapshot> lock;
+        Snapshot in;
+        for(unsigned int i = 0; i < 64; i++){
+            in.values[i] = i;
+        }
+        lock.store(in);
+        const Snapshot out = lock.load();
+        for(unsigned int i = 0; i < 64; i++){
+            CHECK(out.values[i] == i);
+        }
+        CHECK(lock.get_version() == 1);
+    }
+    //< Test payload which is not a multiple of the word size
+    TEST_CASE("Odd sized payload"){
+        struct Small{ char c[3]; };
+        SeqLock<Small> lock(Small{{'a', 'b', 'c'}});
+        Small out;
+        REQUIRE(lock.try_load(out));
+        CHECK(out.c[0] == 'a');
+        CHECK(out.c[2] == 'c');
+    }
+    //< Test readers never observe a torn snapshot
+    TEST_CASE("Concurrent readers"){
+        SeqLock<Snapshot> lock;
+        std::atomic<bool> done(false);
+        std::atomic<unsigned int> torn(0);
+        std::vector<std::thread> readers;
+        for(unsigned int t = 0; t < 3; t++){
+            readers.emplace_back([&](){
+                while(!done.load()){
+                    const Snapshot s = lock.load();
+                    for(unsigned int i = 1; i < 64; i++){
+                        if(s.values[i] != s.values[0]){
+                            torn++;
+                        }
+                    }
+                }
+            });
+        }
+        for(unsigned long n = 1; n <= 20000; n++){
+            Snapshot s;
+            for(unsigned int i = 0; i < 64; i++){
+                s.values[i] = n;
+            }
+            lock.store(s);
+        }
+        done = true;
+        for(auto& reader : readers){
+            reader.join();
+        }
+        CHECK(torn.load() == 0);
+        CHECK(lock.get_version() == 20000);
+    }
+}
+
+/**
+ * @brief test function for NumaTopology
+ */
+TEST_SUITE("NumaTopology"){
+    //< Test fallback without sysfs
+    TEST_CASE("Missing sysfs"){
+        NumaTopology topology("/nonexistent/sys/devices/system/node");
+        CHECK(topology.get_num_nodes() == 1);
+        CHECK(topology.get_num_cpus() >= 1);
+        CHECK(topology.get_current_node() == 0);
+    }
+    //< Test parsing of cpulists with ranges and node id holes
+    TEST_CASE("Two nodes"){
+        NumaTopology topology(make_fake_sysfs("numa_two_nodes", {"0-1,4", "2-3,5"}));
+        CHECK(topology.get_num_nodes() == 2);
+        CHECK(topology.get_num_cpus() == 6);
+        CHECK(topology.get_node_of_cpu(4) == 0);
+        CHECK(topology.get_node_of_cpu(3) == 1);
+        CHECK(topology.get_node_of_cpu(100) == 0);
+        CHECK(topology.get_cpus_of_node(1) == std::vector<unsigned int>{2, 3, 5});
+    }
+    //< Test reversed and out of range cpulists are ignored
+    TEST_CASE("Malformed ranges"){
+        NumaTopology topology(make_fake_sysfs("numa_malformed", {"0-1,3-2", "2,4-4294967295,5-99999999"}));
+        CHECK(topology.get_num_nodes() == 2);
+        CHECK(topology.get_num_cpus() == 3);
+        CHECK(topology.get_cpus_of_node(0) == std::vector<unsigned int>{0, 1});
+        CHECK(topology.get_cpus_of_node(1) == std::vector<unsigned int>{2});
+    }
+    //< Test system topology is valid
+    TEST_CASE("System topology"){
+        const NumaTopology& topology = NumaTopology::get_system();
+        CHECK(topology.get_num_nodes() >= 1);
+        CHECK(topology.get_current_node() < topology.get_num_nodes());
+    }
+}
+
+/**
+ * @brief test function for CohortLock
+ */
+TEST_SUITE("CohortLock"){
+    //< Test mutual exclusion on this machine
+    TEST_CASE("Mutual exclusion"){
+        CohortLock lock;
+        CHECK(count_under_lock(lock, 4, 20000) == 80000);
+    }
+    //< Test mutual exclusion without local handovers
+    TEST_CASE("Zero batch"){
+        CohortLock lock(0);
+        CHECK(count_under_lock(lock, 4, 20000) == 80000);
+    }
+    //< Test mutual exclusion with several nodes
+    TEST_CASE("Several nodes"){
+        NumaTopology topology(make_fake_sysfs("numa_cohort", {"0", "1", "2-1023"}));
+        CohortLock lock(topology, 4);
+        CHECK(lock.get_num_nodes() == 3);
+        CHECK(count_under_lock(lock, 4, 20000) == 80000);
+    }
+}
+
+/**
+ * @brief test function for FutexLock
+ */
+TEST_SUITE("FutexLock"){
+    //< Test mutual exclusion with short critical sections
+    TEST_CASE("Mutual exclusion"){
+        FutexLock lock;
+        CHECK(count_under_lock(lock, 4, 20000) == 80000);
+    }
+    //< Test mutual exclusion with parking only
+    TEST_CASE("No spinning"){
+        FutexLock lock(0);
+        CHECK(lock.get_spin_budget_in_ns() == 0);
+        CHECK(count_under_lock(lock, 4, 20000) == 80000);
+    }
+    //< Test waiters park during long critical sections
+    TEST_CASE("Long critical section"){
+        FutexLock lock;
+        lock.acquire();
+        std::atomic<bool> entered(false);
+        std::thread waiter([&](){
+            lock.acquire();
+            entered = true;
+            lock.release();
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        CHECK(entered.load() == false);
+        lock.release();
+        waiter.join();
+        CHECK(entered.load() == true);
+    }
+    //< Test spin budget stays bounded for long hold times
+    TEST_CASE("Bounded spin budget"){
+        FutexLock lock(20000);
+        for(unsigned int i = 0; i < 64; i++){
+            lock.acquire();
+            std::this_thread::sleep_for(std::chrono::microseconds(100));
+            lock.release();
+        }
+        CHECK(lock.get_spin_budget_in_ns() <= 20000);
+    }
+}
+
+// every mutual exclusion lock of the library offers the full interface
+static_assert(LibraryLock<SpinLock>);
+static_assert(LibraryLock<AtomicLock>);
+static_assert(LibraryLock<CohortLock>);
+static_assert(LibraryLock<FutexLock>);
+static_assert(LibraryLock<AdaptiveLock>);
+static_assert(LibraryLock<InstrumentedLock<SpinLock, true>>);
+static_assert(LibraryLock<InstrumentedLock<FutexLock, false>>);
+
+/**
+ * @brief test function for the Lockable interface of all locks
+ */
+TEST_SUITE("Lockable"){
+    //< Test try_lock on a free and on a held lock
+    TEST_CASE_TEMPLATE("try_lock", Lock, SpinLock, AtomicLock, CohortLock, FutexLock, AdaptiveLock){
+        Lock lock;
+        REQUIRE(lock.try_lock());
+        bool acquired = true;
+        std::thread other([&](){ acquired = lock.try_lock(); });
+        other.join();
+        CHECK(acquired == false);
+        lock.unlock();
+        CHECK(lock.try_acquire());
+        lock.release();
+    }
+    //< Test timed acquisition gives up after the timeout
+    TEST_CASE_TEMPLATE("try_lock_for", Lock, SpinLock, AtomicLock, CohortLock, FutexLock, AdaptiveLock){
+        Lock lock;
+        lock.lock();
+        bool acquired = true;
+        std::chrono::steady_clock::duration waited;
+        std::thread other([&](){
+            const auto start = std::chrono::steady_clock::now();
+            acquired = lock.try_lock_for(std::chrono::milliseconds(10));
+            waited = std::chrono::steady_clock::now() - start;
+        });
+        other.join();
+        CHECK(acquired == false);
+        CHECK(waited >= std::chrono::milliseconds(10));
+        lock.unlock();
+        CHECK(lock.try_lock_until(std::chrono::steady_clock::now() + std::chrono::milliseconds(10)));
+        lock.unlock();
+    }
+    //< Test timed acquisition succeeds once the owner releases
+    TEST_CASE_TEMPLATE("try_lock_until", Lock, SpinLock, AtomicLock, CohortLock, FutexLock, AdaptiveLock){
+        Lock lock;
+        lock.lock();
+        bool acquired = false;
+        std::thread other([&](){
+            acquired = lock.try_lock_until(std::chrono::system_clock::now() + std::chrono::seconds(10));
+            if(acquired){
+                lock.unlock();
+            }
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        lock.unlock();
+        other.join();
+        CHECK(acquired == true);
+    }
+    //< Test standard RAII wrappers
+    TEST_CASE_TEMPLATE("Standard wrappers", Lock, SpinLock, AtomicLock, CohortLock, FutexLock, AdaptiveLock){
+        Lock first;
+        Lock second;
+        unsigned long counter = 0;
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < 4; t++){
+            threads.emplace_back([&](){
+                for(unsigned int i = 0; i < 5000; i++){
+                    if(i % 2 == 0){
+                        std::lock_guard<Lock> guard(first);
+                        counter++;
+                    }else{
+                        std::scoped_lock guard(second, first);
+                        counter++;
+                    }
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        CHECK(counter == 20000);
+        std::unique_lock<Lock> guard(first, std::chrono::milliseconds(1));
+        CHECK(guard.owns_lock());
+    }
+    //< Test std::condition_variable_any
+    TEST_CASE_TEMPLATE("condition_variable_any", Lock, SpinLock, AtomicLock, CohortLock, FutexLock, AdaptiveLock){
+        Lock lock;
+        std::condition_variable_any ready;
+        bool flag = false;
+        std::thread producer([&](){
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            std::lock_guard<Lock> guard(lock);
+            flag = true;
+            ready.notify_one();
+        });
+        {
+            std::unique_lock<Lock> guard(lock);
+            ready.wait(guard, [&](){ return flag; });
+            CHECK(flag);
+        }
+        producer.join();
+    }
+}
+
+/**
+ * @brief test function for InstrumentedLock<Lock>
+ */
+TEST_SUITE("InstrumentedLock"){
+    //< Test disabled profiling has no overhead
+    TEST_CASE("Disabled profiling"){
+        CHECK(sizeof(InstrumentedLock<SpinLock, false>) == sizeof(SpinLock));
+        InstrumentedLock<SpinLock, false> lock("disabled");
+        CHECK(count_under_lock(lock, 4, 1000) == 4000);
+        CHECK(lock.get_statistics().get_acquisitions() == 0);
+        std::stringstream report;
+        LockStatistics::report(report);
+        CHECK(report.str().find("disabled") == std::string::npos);
+    }
+    //< Test counters of uncontended acquisitions
+    TEST_CASE("Uncontended"){
+        InstrumentedLock<SpinLock, true> lock("uncontended");
+        for(unsigned int i = 0; i < 10; i++){
+            std::lock_guard<InstrumentedLock<SpinLock, true>> guard(lock);
+        }
+        CHECK(lock.get_statistics().get_acquisitions() == 10);
+        CHECK(lock.get_statistics().get_contended() == 0);
+        CHECK(lock.get_statistics().get_wait_in_ns() == 0);
+    }
+    //< Test timed acquisitions of a free lock are not counted as contended
+    TEST_CASE("Uncontended timed"){
+        InstrumentedLock<FutexLock, true> lock("uncontended_timed");
+        for(unsigned int i = 0; i < 10; i++){
+            CHECK(lock.try_lock_for(std::chrono::milliseconds(1)));
+            lock.unlock();
+        }
+        CHECK(lock.get_statistics().get_acquisitions() == 10);
+        CHECK(lock.get_statistics().get_contended() == 0);
+        CHECK(lock.get_statistics().get_wait_in_ns() == 0);
+    }
+    //< Test contended acquisitions are recorded
+    TEST_CASE("Contended"){
+        InstrumentedLock<FutexLock, true> lock("contended");
+        lock.acquire();
+        std::thread waiter([&](){
+            lock.acquire();
+            lock.release();
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        lock.release();
+        waiter.join();
+        const LockStatistics& statistics = lock.get_statistics();
+        CHECK(statistics.get_acquisitions() == 2);
+        CHECK(statistics.get_contended() == 1);
+        CHECK(statistics.get_hold_in_ns() >= 5000000);
+        CHECK(statistics.get_hold_percentile_in_ns(1.) >= 5000000);
+        CHECK(statistics.get_wait_percentile_in_ns(0.) == 0);
+    }
+    //< Test mutual exclusion and ranked report
+    TEST_CASE("Report"){
+        InstrumentedLock<AtomicLock, true> hot("hot_lock");
+        InstrumentedLock<AtomicLock, true> cold("cold_lock");
+        CHECK(count_under_lock(hot, 4, 5000) == 20000);
+        cold.acquire();
+        cold.release();
+        std::stringstream report;
+        LockStatistics::report(report);
+        CHECK(report.str().find("hot_lock") != std::string::npos);
+        CHECK(report.str().find("cold_lock") != std::string::npos);
+        std::stringstream histogram;
+        hot.get_statistics().print(histogram);
+        CHECK(histogram.str().find("20000 acquisitions") != std::string::npos);
+    }
+}
+
+/**
+ * @brief test function for StripedLock<Lock, N>
+ */
+TEST_SUITE("StripedLock"){
+    //< Test stripes are padded to cache lines
+    TEST_CASE("Padding"){
+        StripedLock<SpinLock, 16> lock;
+        CHECK(sizeof(lock) == 16 * CACHE_LINE_SIZE);
+        const char* first = reinterpret_cast<const char*>(&lock.get_lock(0));
+        const char* second = reinterpret_cast<const char*>(&lock.get_lock(1));
+        CHECK(second - first == long(CACHE_LINE_SIZE));
+    }
+    //< Test mapping of keys and addresses
+    TEST_CASE("Mapping"){
+        using Striped = StripedLock<SpinLock, 12>;
+        std::vector<unsigned int> hits(Striped::get_num_stripes(), 0);
+        for(unsigned long key = 0; key < 12000; key++){
+            const std::size_t stripe = Striped::get_stripe_of(key);
+            REQUIRE(stripe < 12);
+            CHECK(stripe == Striped::get_stripe_of(key));
+            hits[stripe]++;
+        }
+        // consecutive keys are spread over all stripes
+        for(const unsigned int h : hits){
+            CHECK(h > 500);
+        }
+        int values[4];
+        CHECK(Striped::get_stripe_of_address(&values[1]) < 12);
+        CHECK(Striped::get_stripe_of(std::string("key")) < 12);
+    }
+    //< Test ordered multi-stripe acquisition with duplicates
+    TEST_CASE("Duplicate keys"){
+        StripedLock<SpinLock, 4> lock;
+        {
+            auto guard = lock.lock_keys(1, 1, 2, 3, 4, 5);
+        }
+        // all stripes were released
+        for(std::size_t i = 0; i < 4; i++){
+            CHECK(lock.get_lock(i).try_lock());
+        }
+    }
+    //< Test transfers between accounts in opposite orders do not deadlock
+    TEST_CASE("No deadlock"){
+        StripedLock<FutexLock, 8> lock;
+        std::vector<long> accounts(64, 1000);
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < 4; t++){
+            threads.emplace_back([&, t](){
+                for(unsigned int i = 0; i < 20000; i++){
+                    const unsigned int from = (i * 7 + t) % 64;
+                    const unsigned int to = (i * 13 + 3 * t + 1) % 64;
+                    auto guard = (t % 2 == 0) ? lock.lock_keys(from, to) : lock.lock_keys(to, from);
+                    accounts[from]--;
+                    accounts[to]++;
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        long total = 0;
+        for(const long a : accounts){
+            total += a;
+        }
+        CHECK(total == 64000);
+        lock.acquire_all();
+        lock.release_all();
+    }
+}
+
+/**
+ * @brief test function for AdaptiveLock
+ */
+TEST_SUITE("AdaptiveLock"){
+    //< Test mutual exclusion with the default window
+    TEST_CASE("Mutual exclusion"){
+        AdaptiveLock lock;
+        CHECK(count_under_lock(lock, 4, 20000) == 80000);
+    }
+    //< Test mutual exclusion while switching modes often
+    TEST_CASE("Frequent switches"){
+        AdaptiveLock lock(2);
+        CHECK(count_under_lock(lock, 4, 20000) == 80000);
+    }
+    //< Test switch to queue mode under contention and back without
+    TEST_CASE("Mode switches"){
+        AdaptiveLock lock(4);
+        CHECK(lock.is_queue_mode() == false);
+        lock.acquire();
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < 8; t++){
+            threads.emplace_back([&](){
+                lock.acquire();
+                lock.release();
+            });
+        }
+        // all threads find the lock taken
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        lock.release();
+        for(auto& thread : threads){
+            thread.join();
+        }
+        CHECK(lock.is_queue_mode() == true);
+        CHECK(lock.get_mode_switches() == 1);
+        for(unsigned int i = 0; i < 32; i++){
+            lock.acquire();
+            lock.release();
+        }
+        CHECK(lock.is_queue_mode() == false);
+        CHECK(lock.get_mode_switches() == 2);
+        CHECK(count_under_lock(lock, 4, 1000) == 4000);
+    }
+}
+
+/**
+ * @brief test function for FlatCombiner<T>
+ */
+TEST_SUITE("FlatCombiner"){
+    //< Test results of operations
+    TEST_CASE("Apply"){
+        FlatCombiner<std::vector<int>> combiner(3, 7);
+        CHECK(combiner.apply([](std::vector<int>& v){ return v.size(); }) == 3);
+        combiner.apply([](std::vector<int>& v){ v.push_back(1); });
+        CHECK(combiner.apply([](std::vector<int>& v){ return v.back(); }) == 1);
+        CHECK(combiner.get_unsafe().front() == 7);
+    }
+    //< Test exceptions are rethrown in the publishing thread
+    TEST_CASE("Exception"){
+        FlatCombiner<int> combiner(0);
+        CHECK_THROWS_AS(combiner.apply([](int&) -> int { throw std::runtime_error("failed"); }),
+                        std::runtime_error);
+        CHECK(combiner.apply([](int& x){ return ++x; }) == 1);
+    }
+    //< Test concurrent counter increments
+    TEST_CASE_TEMPLATE("Counter", Lock, SpinLock, FutexLock){
+        FlatCombiner<unsigned long, Lock> combiner(0ul);
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < 4; t++){
+            threads.emplace_back([&](){
+                for(unsigned int i = 0; i < 20000; i++){
+                    combiner.apply([](unsigned long& counter){ counter++; });
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        CHECK(combiner.get_unsafe() == 80000);
+        CHECK(combiner.get_passes() >= 1);
+    }
+    //< Test shared slots with more threads than slots
+    TEST_CASE("Shared slots"){
+        FlatCombiner<std::queue<int>, SpinLock, 2> combiner;
+        std::atomic<long> popped_sum(0);
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < 6; t++){
+            threads.emplace_back([&, t](){
+                for(int i = 0; i < 5000; i++){
+                    if(t % 2 == 0){
+                        combiner.apply([i](std::queue<int>& q){ q.push(i); });
+                    }else{
+                        popped_sum += combiner.apply([](std::queue<int>& q){
+                            if(q.empty()){
+                                return 0;
+                            }
+                            const int front = q.front();
+                            q.pop();
+                            return front;
+                        });
+                    }
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        long remaining_sum = 0;
+        std::queue<int>& q = combiner.get_unsafe();
+        while(!q.empty()){
+            remaining_sum += q.front();
+            q.pop();
+        }
+        CHECK(popped_sum.load() + remaining_sum == 3l * 4999 * 5000 / 2);
+    }
+}
+
+/**
+ * @brief test function for DelegationLock<T>
+ */
+TEST_SUITE("DelegationLock"){
+    //< Test results of critical sections executed by the server
+    TEST_CASE("Apply"){
+        DelegationLock<std::vector<int>> lock(3, 7);
+        CHECK(lock.apply([](std::vector<int>& v){ return v.size(); }) == 3);
+        lock.apply([](std::vector<int>& v){ v.push_back(1); });
+        CHECK(lock.apply([](std::vector<int>& v){ return v.back(); }) == 1);
+        CHECK(lock.apply([](std::vector<int>&){ return std::this_thread::get_id(); }) != std::this_thread::get_id());
+        CHECK(lock.get_served() == 4);
+        CHECK(lock.get_unsafe().front() == 7);
+    }
+    //< Test exceptions are rethrown in the client and nested calls run directly
+    TEST_CASE("Exception and nesting"){
+        DelegationLock<int> lock(0);
+        CHECK_THROWS_AS(lock.apply([](int&) -> int { throw std::runtime_error("failed"); }),
+                        std::runtime_error);
+        CHECK(lock.apply([&](int& x){ return lock.apply([](int& y){ return ++y; }) + x; }) == 2);
+    }
+    //< Test concurrent counter increments, also after the server parked
+    TEST_CASE("Counter"){
+        DelegationLock<unsigned long> lock(0ul);
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < 4; t++){
+            threads.emplace_back([&](){
+                for(unsigned int i = 0; i < 20000; i++){
+                    lock.apply([](unsigned long& counter){ counter++; });
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        CHECK(lock.get_unsafe() == 80000);
+        CHECK(lock.get_served() == 80000);
+        CHECK(lock.get_passes() >= 1);
+        CHECK(lock.get_passes() <= 80000);
+    }
+    //< Test shared slots with more clients than slots
+    TEST_CASE("Shared slots"){
+        DelegationLock<std::queue<int>, 2> lock;
+        std::atomic<long> popped_sum(0);
+        std::vector<std::thread> threads;
+        for(unsigned int t = 0; t < 6; t++){
+            threads.emplace_back([&, t](){
+                for(int i = 0; i < 5000; i++){
+                    if(t % 2 == 0){
+                        lock.apply([i](std::queue<int>& q){ q.push(i); });
+                    }else{
+                        popped_sum += lock.apply([](std::queue<int>& q){
+                            if(q.empty()){
+                                return 0;
+                            }
+                            const int front = q.front();
+                            q.pop();
+                            return front;
+                        });
+                    }
+                }
+            });
+        }
+        for(auto& thread : threads){
+            thread.join();
+        }
+        long remaining_sum = 0;
+        std::queue<int>& q = lock.get_unsafe();
+        while(!q.empty()){
+            remaining_sum += q.front();
+            q.pop();
+        }
+        CHECK(popped_sum.load() + remaining_sum == 3l * 4999 * 5000 / 2);
+    }
+}
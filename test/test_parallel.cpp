@@ -0,0 +1,362 @@
+/**
+ * @file    : test_parallel.cpp
+ * @brief   : test code of the thread pool and parallel algorithms
+ * @author  : David Blickenstorfer
+ * 
+ * @date 18/10/2026 (ThreadPool and TaskGroup)
+ * @date 18/10/2026 (parallel_for and parallel_reduce)
+ * @date 18/10/2026 (parallel algorithms)
+ * @date 18/10/2026 (barriers)
+ * @copyright Developed by David Blickenstorfer
+ */
+
+#define DOCTEST_CONFIG_IMPLEMENT_WITH_MAIN
+
+#include "doctest.h"
+#include "../include/ThreadPool.hpp"
+#include "../include/ParallelFor.hpp"
+#include "../include/ParallelAlgorithms.hpp"
+#include "../include/Barrier.hpp"
+
+#include <thread>
+#include <vector>
+#include <atomic>
+#include <stdexcept>
+#include <chrono>
+#include <algorithm>
+#include <numeric>
+#include <string>
+
+/**
+ * @brief recursive Fibonacci number with one task per call
+ */
+static long fibonacci(ThreadPool& pool, int n)
+{
+    if(n < 2){
+        return n;
+    }
+    long left = 0;
+    TaskGroup group(pool);
+    group.run([&](){ left = fibonacci(pool, n - 1); });
+    const long right = fibonacci(pool, n - 2);
+    group.wait();
+    return left + right;
+}
+
+/**
+ * @brief test function for ThreadPool and TaskGroup
+ */
+TEST_SUITE("ThreadPool"){
+    //< Test number of workers
+    TEST_CASE("Workers"){
+        ThreadPool pool(3);
+        CHECK(pool.get_num_threads() == 3);
+        CHECK(pool.get_worker_index() == -1);
+        std::atomic<int> index(-2);
+        pool.submit([&](){ index = pool.get_worker_index(); });
+        // wait() would run the task on this thread
+        while(index.load() == -2){
+            std::this_thread::yield();
+        }
+        pool.wait();
+        CHECK(index.load() >= 0);
+        CHECK(index.load() < 3);
+        CHECK(ThreadPool(0).get_num_threads() == 1);
+    }
+    //< Test all submitted tasks run before wait returns
+    TEST_CASE("Submit and wait"){
+        ThreadPool pool(4);
+        std::atomic<int> counter(0);
+        for(int i = 0; i < 10000; i++){
+            pool.submit([&](){ counter++; });
+        }
+        pool.wait();
+        CHECK(counter.load() == 10000);
+        // the pool is reusable after waiting
+        pool.submit([&](){ counter++; });
+        pool.wait();
+        CHECK(counter.load() == 10001);
+    }
+    //< Test tasks spawned by tasks are waited for
+    TEST_CASE("Tasks submitting tasks"){
+        ThreadPool pool(2);
+        std::atomic<int> counter(0);
+        for(int i = 0; i < 100; i++){
+            pool.submit([&](){
+                for(int j = 0; j < 10; j++){
+                    pool.submit([&](){ counter++; });
+                }
+            });
+        }
+        pool.wait();
+        CHECK(counter.load() == 1000);
+    }
+    //< Test nested task groups inside workers do not block the pool
+    TEST_CASE("Nested task groups"){
+        ThreadPool pool(2);
+        CHECK(fibonacci(pool, 20) == 6765);
+        long result = 0;
+        pool.submit([&](){ result = fibonacci(pool, 18); });
+        pool.wait();
+        CHECK(result == 2584);
+    }
+    //< Test the first exception is rethrown by wait
+    TEST_CASE("Exceptions"){
+        ThreadPool pool(2);
+        TaskGroup group(pool);
+        std::atomic<int> counter(0);
+        group.run([](){ throw std::runtime_error("task failed"); });
+        group.run([&](){ counter++; });
+        CHECK_THROWS_AS(group.wait(), std::runtime_error);
+        CHECK(counter.load() == 1);
+        group.wait();
+        pool.submit([](){ throw std::logic_error("task failed"); });
+        CHECK_THROWS_AS(pool.wait(), std::logic_error);
+        pool.wait();
+    }
+    //< Test parked workers are woken up by new tasks
+    TEST_CASE("Parked workers"){
+        ThreadPool pool(2);
+        // give the idle workers time to park
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        std::atomic<int> counter(0);
+        for(int i = 0; i < 10; i++){
+            pool.submit([&](){ counter++; });
+        }
+        while(counter.load() < 10){
+            std::this_thread::yield();
+        }
+        pool.wait();
+        CHECK(counter.load() == 10);
+    }
+    //< Test the destructor finishes pending tasks
+    TEST_CASE("Destructor"){
+        std::atomic<int> counter(0);
+        {
+            ThreadPool pool(2);
+            for(int i = 0; i < 100; i++){
+                pool.submit([&](){ counter++; });
+            }
+        }
+        CHECK(counter.load() == 100);
+    }
+}
+
+/**
+ * @brief all schedules of the parallel_for tests
+ */
+static const Schedule schedules[] = {
+    schedule_static(), schedule_static(3), schedule_dynamic(), schedule_dynamic(7),
+    schedule_guided(), schedule_guided(5), schedule_auto()
+};
+
+/**
+ * @brief test function for parallel_for and parallel_reduce
+ */
+TEST_SUITE("ParallelFor"){
+    //< Test every iteration runs exactly once for all schedules
+    TEST_CASE("Iterations"){
+        ThreadPool pool(3);
+        for(const Schedule& schedule : schedules){
+            for(int n : {0, 1, 2, 5, 1000}){
+                std::vector<int> counts(n, 0);
+                parallel_for(0, n, [&](int i){ counts[i]++; }, schedule, pool);
+                CHECK(std::count(counts.begin(), counts.end(), 1) == n);
+            }
+        }
+    }
+    //< Test ranges not starting at zero and blocks
+    TEST_CASE("Ranges and blocks"){
+        ThreadPool pool(2);
+        std::vector<int> counts(20, 0);
+        parallel_for(-10, 10, [&](int i){ counts[i + 10]++; }, schedule_dynamic(3), pool);
+        CHECK(std::count(counts.begin(), counts.end(), 1) == 20);
+        std::atomic<long> covered(0);
+        parallel_for_blocks(100ul, 1100ul, [&](unsigned long begin, unsigned long end){
+            CHECK(begin < end);
+            covered += long(end - begin);
+        }, schedule_guided(10), pool);
+        CHECK(covered.load() == 1000);
+        parallel_for(5, 5, [&](int){ FAIL("empty range"); }, schedule_static(), pool);
+    }
+    //< Test nested loops inside a parallel loop
+    TEST_CASE("Nested loops"){
+        ThreadPool pool(2);
+        std::vector<std::atomic<int>> counts(64 * 64);
+        parallel_for(0, 64, [&](int i){
+            parallel_for(0, 64, [&](int j){ counts[i * 64 + j]++; }, schedule_dynamic(4), pool);
+        }, schedule_static(), pool);
+        int ones = 0;
+        for(const auto& count : counts){
+            ones += (count.load() == 1);
+        }
+        CHECK(ones == 64 * 64);
+    }
+    //< Test reductions for all schedules
+    TEST_CASE("Reduce"){
+        ThreadPool pool(4);
+        const long n = 100000;
+        for(const Schedule& schedule : schedules){
+            const long sum = parallel_reduce(0l, n, 0l, [](long i){ return i; },
+                                             [](long a, long b){ return a + b; }, schedule, pool);
+            CHECK(sum == n * (n - 1) / 2);
+        }
+        const int maximum = parallel_reduce(0, 1000, -1, [](int i){ return (i * 37) % 1000; },
+                                            [](int a, int b){ return std::max(a, b); }, schedule_guided(), pool);
+        CHECK(maximum == 999);
+        CHECK(parallel_reduce(3, 3, 42, [](int i){ return i; }, [](int a, int b){ return a + b; }) == 42);
+    }
+    //< Test an exception of an iteration reaches the caller
+    TEST_CASE("Exceptions"){
+        ThreadPool pool(2);
+        CHECK_THROWS_AS(parallel_for(0, 100, [](int i){
+            if(i == 77){
+                throw std::runtime_error("iteration failed");
+            }
+        }, schedule_dynamic(), pool), std::runtime_error);
+        // the pool is still usable
+        std::atomic<int> counter(0);
+        parallel_for(0, 100, [&](int){ counter++; }, schedule_static(), pool);
+        CHECK(counter.load() == 100);
+    }
+}
+
+/**
+ * @brief input sizes of the algorithm tests, around the block boundaries
+ */
+static const std::size_t algorithm_sizes[] = {0, 1, 100, 3 * algorithm_grain_size + 7, 100000};
+
+/**
+ * @brief test function for the parallel algorithms
+ */
+TEST_SUITE("ParallelAlgorithms"){
+    //< Test fill and iota
+    TEST_CASE("Fill and iota"){
+        ThreadPool pool(4);
+        for(std::size_t n : algorithm_sizes){
+            std::vector<int> values(n, 0);
+            parallel_fill(values.begin(), values.end(), 7, pool);
+            CHECK(std::count(values.begin(), values.end(), 7) == long(n));
+            parallel_iota(values.begin(), values.end(), -3, pool);
+            std::vector<int> expected(n);
+            std::iota(expected.begin(), expected.end(), -3);
+            CHECK(values == expected);
+        }
+    }
+    //< Test unary and binary transform_reduce
+    TEST_CASE("Transform reduce"){
+        ThreadPool pool(4);
+        for(std::size_t n : algorithm_sizes){
+            std::vector<long> values(n);
+            std::iota(values.begin(), values.end(), 1);
+            const long squares = parallel_transform_reduce(values.begin(), values.end(), 5l, std::plus<>(),
+                                                           [](long x){ return x * x; }, pool);
+            CHECK(squares == std::transform_reduce(values.begin(), values.end(), 5l, std::plus<>(),
+                                                   [](long x){ return x * x; }));
+            const long dot = parallel_transform_reduce(values.begin(), values.end(), values.rbegin(), 0l,
+                                                       std::plus<>(), std::multiplies<>(), pool);
+            CHECK(dot == std::inner_product(values.begin(), values.end(), values.rbegin(), 0l));
+        }
+    }
+    //< Test inclusive and exclusive scan, also in place
+    TEST_CASE("Scan"){
+        ThreadPool pool(4);
+        for(std::size_t n : algorithm_sizes){
+            std::vector<long> values(n);
+            for(std::size_t i = 0; i < n; i++){
+                values[i] = long(i % 13) - 6;
+            }
+            std::vector<long> expected(n);
+            std::vector<long> result(n);
+            std::inclusive_scan(values.begin(), values.end(), expected.begin());
+            CHECK(parallel_inclusive_scan(values.begin(), values.end(), result.begin(), std::plus<>(), pool)
+                  == result.end());
+            CHECK(result == expected);
+            std::exclusive_scan(values.begin(), values.end(), expected.begin(), 100l);
+            parallel_exclusive_scan(values.begin(), values.end(), result.begin(), 100l, std::plus<>(), pool);
+            CHECK(result == expected);
+            parallel_exclusive_scan(values.begin(), values.end(), values.begin(), 100l, std::plus<>(), pool);
+            CHECK(values == expected);
+        }
+        // non-commutative operation, the order of the blocks is kept
+        std::vector<std::string> words(3 * algorithm_grain_size, "a");
+        words[algorithm_grain_size] = "b";
+        std::vector<std::string> concatenated(words.size());
+        parallel_inclusive_scan(words.begin(), words.end(), concatenated.begin(), std::plus<>(), pool);
+        CHECK(concatenated.back().size() == words.size());
+        CHECK(concatenated.back()[algorithm_grain_size] == 'b');
+    }
+    //< Test copy_if and partitions keep the order
+    TEST_CASE("Copy if and partition"){
+        ThreadPool pool(4);
+        auto is_odd = [](int x){ return x % 2 != 0; };
+        for(std::size_t n : algorithm_sizes){
+            std::vector<int> values(n);
+            for(std::size_t i = 0; i < n; i++){
+                values[i] = int((i * 7919) % 1000);
+            }
+            std::vector<int> expected;
+            std::copy_if(values.begin(), values.end(), std::back_inserter(expected), is_odd);
+            std::vector<int> result(n);
+            auto end = parallel_copy_if(values.begin(), values.end(), result.begin(), is_odd, pool);
+            result.erase(end, result.end());
+            CHECK(result == expected);
+
+            std::vector<int> odd(n);
+            std::vector<int> even(n);
+            auto [end_odd, end_even] = parallel_partition_copy(values.begin(), values.end(), odd.begin(),
+                                                               even.begin(), is_odd, pool);
+            CHECK(std::size_t(end_odd - odd.begin()) == expected.size());
+            CHECK(std::size_t(end_even - even.begin()) == n - expected.size());
+
+            std::vector<int> stable(values);
+            std::stable_partition(stable.begin(), stable.end(), is_odd);
+            CHECK(parallel_partition(values.begin(), values.end(), is_odd, pool) - values.begin()
+                  == long(expected.size()));
+            CHECK(values == stable);
+        }
+    }
+}
+
+/**
+ * @brief test function for the barriers
+ */
+TEST_SUITE("Barrier"){
+    //< Test no thread leaves an episode before all arrived, for several thread counts
+    TEST_CASE_TEMPLATE("Phases", Barrier, SenseBarrier, DisseminationBarrier, TournamentBarrier){
+        for(unsigned int num_threads : {1u, 2u, 3u, 5u, 8u}){
+            const unsigned int num_phases = 200;
+            Barrier barrier(num_threads);
+            CHECK(barrier.get_num_threads() == num_threads);
+            std::vector<std::atomic<unsigned int>> phases(num_threads);
+            std::atomic<unsigned int> errors(0);
+            std::vector<std::thread> threads;
+            for(unsigned int t = 0; t < num_threads; t++){
+                threads.emplace_back([&, t](){
+                    for(unsigned int phase = 1; phase <= num_phases; phase++){
+                        phases[t].store(phase);
+                        barrier.arrive_and_wait(t);
+                        // all threads finished the writes of this phase
+                        for(unsigned int other = 0; other < num_threads; other++){
+                            if(phases[other].load() < phase){
+                                errors++;
+                            }
+                        }
+                        barrier.arrive_and_wait(t);
+                        // nobody started the next phase before all checked
+                        for(unsigned int other = 0; other < num_threads; other++){
+                            if(phases[other].load() != phase){
+                                errors++;
+                            }
+                        }
+                        barrier.arrive_and_wait(t);
+                    }
+                });
+            }
+            for(auto& thread : threads){
+                thread.join();
+            }
+            CHECK(errors.load() == 0);
+        }
+    }
+}